@@ -19,10 +19,11 @@ int LLVMFuzzerTestOneInput(const uint8_t *data, const size_t size) {
 	clearMenuBuffers();
 	
 	// Set state to be after continue encrypting slate request
-	slate.encryptingState = COMPLETE_SLATE_STATE;
-	initializeChaCha20Poly1305(&slate.chaCha20Poly1305State, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21}, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B}, NULL, 0, 0, NULL);
+	struct SlateSession *session = startSlateSession((size > 1) ? data[1] : 0);
+	session->encryptingState = COMPLETE_SLATE_STATE;
+	initializeChaCha20Poly1305(&session->chaCha20Poly1305State, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21}, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B}, NULL, 0, 0, NULL);
 	uint8_t encryptedData[5];
-	encryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&slate.chaCha20Poly1305State, encryptedData, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04}, 5);
+	encryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&session->chaCha20Poly1305State, encryptedData, (uint8_t[]){0x00, 0x01, 0x02, 0x03, 0x04}, 5);
 	
 	// Copy data into APDU buffer
 	G_io_apdu_buffer[APDU_OFF_CLA] = REQUEST_CLASS;
@@ -0,0 +1,535 @@
+// Header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "common.h"
+#include "menus.h"
+#include "process_requests.h"
+#include "root_public_key_cache.h"
+#include "snapshot.h"
+#include "state.h"
+#include "storage.h"
+
+
+// Definitions
+
+// Input header size
+#define INPUT_HEADER_SIZE 1
+
+// Input start snapshot mask
+#define INPUT_START_SNAPSHOT_MASK 0b00001111
+
+// Input save snapshot shift
+#define INPUT_SAVE_SNAPSHOT_SHIFT 4
+
+// Request header size
+#define REQUEST_HEADER_SIZE 5
+
+// Request options offset
+#define REQUEST_OPTIONS_OFFSET 0
+
+// Request instruction offset
+#define REQUEST_INSTRUCTION_OFFSET 1
+
+// Request first parameter offset
+#define REQUEST_FIRST_PARAMETER_OFFSET 2
+
+// Request second parameter offset
+#define REQUEST_SECOND_PARAMETER_OFFSET 3
+
+// Request data length offset
+#define REQUEST_DATA_LENGTH_OFFSET 4
+
+// Chained request option
+#define CHAINED_REQUEST_OPTION 0b00000001
+
+// Approve user interaction option
+#define APPROVE_USER_INTERACTION_OPTION 0b00000010
+
+// Take snapshot option
+#define TAKE_SNAPSHOT_OPTION 0b00000100
+
+// Restore snapshot option
+#define RESTORE_SNAPSHOT_OPTION 0b00001000
+
+// Options mask
+#define OPTIONS_MASK (CHAINED_REQUEST_OPTION | APPROVE_USER_INTERACTION_OPTION | TAKE_SNAPSHOT_OPTION | RESTORE_SNAPSHOT_OPTION)
+
+// Maximum number of requests
+#define MAXIMUM_NUMBER_OF_REQUESTS 64
+
+// Number of saved snapshots
+#define NUMBER_OF_SAVED_SNAPSHOTS 8
+
+// Maximum requests size
+#define MAXIMUM_REQUESTS_SIZE (MAXIMUM_NUMBER_OF_REQUESTS * (REQUEST_HEADER_SIZE + UINT8_MAX))
+
+// Saved snapshots directory environment variable
+#define SAVED_SNAPSHOTS_DIRECTORY_ENVIRONMENT_VARIABLE "FUZZ_SAVED_SNAPSHOTS_DIRECTORY"
+
+
+// Structures
+
+// Saved snapshot
+struct SavedSnapshot {
+
+	// Snapshot
+	struct Snapshot snapshot;
+
+	// Requests that reach the snapshot from the initial snapshot
+	uint8_t requests[MAXIMUM_REQUESTS_SIZE];
+
+	// Requests size
+	size_t requestsSize;
+
+	// Number of requests
+	size_t numberOfRequests;
+
+	// Exists
+	bool exists;
+};
+
+
+// Function prototypes
+
+// LLVM fuzzer mutate
+size_t LLVMFuzzerMutate(uint8_t *data, size_t size, size_t maxSize);
+
+// Get request offsets
+static size_t getRequestOffsets(size_t *offsets, uint8_t *data, const size_t size);
+
+// Get request length
+static size_t getRequestLength(const uint8_t *data, const size_t offset);
+
+// Replace range
+static size_t replaceRange(uint8_t *data, const size_t size, const size_t maxSize, const size_t offset, const size_t length, const uint8_t *replacement, const size_t replacementLength);
+
+// Get random instruction
+static uint8_t getRandomInstruction(void);
+
+// Reset application
+static void resetApplication(void);
+
+// Save snapshot
+static void saveSnapshot(const size_t index);
+
+
+// Global variables
+
+// Initial snapshot
+static struct Snapshot initialSnapshot;
+
+// Latest snapshot
+static struct Snapshot latestSnapshot;
+
+// Saved snapshots which persist across inputs so that inputs can start from a state that previous inputs reached
+static struct SavedSnapshot savedSnapshots[NUMBER_OF_SAVED_SNAPSHOTS];
+
+// Current requests that reach the current state from the initial snapshot
+static uint8_t currentRequests[MAXIMUM_REQUESTS_SIZE];
+
+// Current requests size
+static size_t currentRequestsSize;
+
+// Number of current requests
+static size_t numberOfCurrentRequests;
+
+
+// Supporting function implementation
+
+// IO exchange
+unsigned short io_exchange(__attribute__((unused)) unsigned char channelAndFlags, __attribute__((unused)) unsigned short length) {
+
+	// Return no request
+	return 0;
+}
+
+// Fuzz initialize
+int LLVMFuzzerInitialize(__attribute__((unused)) int *argc, __attribute__((unused)) char ***argv) {
+
+	// Reset application
+	resetApplication();
+
+	// Take initial snapshot
+	takeSnapshot(&initialSnapshot);
+
+	// Return success
+	return 0;
+}
+
+// Fuzz target
+int LLVMFuzzerTestOneInput(const uint8_t *data, const size_t size) {
+
+	// Check if input header doesn't exist
+	if(size < INPUT_HEADER_SIZE) {
+
+		// Return success
+		return 0;
+	}
+
+	// Get the start snapshot index and save snapshot index from the input header where a start snapshot of zero is the initial snapshot
+	const size_t startSnapshotIndex = (data[0] & INPUT_START_SNAPSHOT_MASK) % (NUMBER_OF_SAVED_SNAPSHOTS + 1);
+	const size_t saveSnapshotIndex = (data[0] >> INPUT_SAVE_SNAPSHOT_SHIFT) % NUMBER_OF_SAVED_SNAPSHOTS;
+
+	// Check if starting from a saved snapshot that exists
+	if(startSnapshotIndex && savedSnapshots[startSnapshotIndex - 1].exists) {
+
+		// Restore the saved snapshot and set it as the latest snapshot
+		restoreSnapshot(&savedSnapshots[startSnapshotIndex - 1].snapshot);
+		memcpy(&latestSnapshot, &savedSnapshots[startSnapshotIndex - 1].snapshot, sizeof(latestSnapshot));
+
+		// Set current requests to the requests that reach the saved snapshot
+		memcpy(currentRequests, savedSnapshots[startSnapshotIndex - 1].requests, savedSnapshots[startSnapshotIndex - 1].requestsSize);
+		currentRequestsSize = savedSnapshots[startSnapshotIndex - 1].requestsSize;
+		numberOfCurrentRequests = savedSnapshots[startSnapshotIndex - 1].numberOfRequests;
+	}
+
+	// Otherwise
+	else {
+
+		// Restore the initial snapshot and set it as the latest snapshot
+		restoreSnapshot(&initialSnapshot);
+		memcpy(&latestSnapshot, &initialSnapshot, sizeof(latestSnapshot));
+
+		// Clear current requests
+		currentRequestsSize = 0;
+		numberOfCurrentRequests = 0;
+	}
+
+	// Boot OS
+	os_boot();
+
+	// Go through all requests in the data while counting the requests that reached the start snapshot so that the current requests can always be replayed as one input
+	for(size_t offset = INPUT_HEADER_SIZE; offset + REQUEST_HEADER_SIZE <= size && numberOfCurrentRequests < MAXIMUM_NUMBER_OF_REQUESTS;) {
+
+		// Get request's data length limited to the data that's available
+		const uint8_t dataLength = MIN(data[offset + REQUEST_DATA_LENGTH_OFFSET], size - offset - REQUEST_HEADER_SIZE);
+
+		// Append request to the current requests with its limited data length
+		memcpy(&currentRequests[currentRequestsSize], &data[offset], REQUEST_HEADER_SIZE + dataLength);
+		currentRequests[currentRequestsSize + REQUEST_DATA_LENGTH_OFFSET] = dataLength;
+		currentRequestsSize += REQUEST_HEADER_SIZE + dataLength;
+		++numberOfCurrentRequests;
+
+		// Check if restoring the latest snapshot before the request
+		if(data[offset + REQUEST_OPTIONS_OFFSET] & RESTORE_SNAPSHOT_OPTION) {
+
+			// Restore latest snapshot
+			restoreSnapshot(&latestSnapshot);
+		}
+
+		// Copy request into APDU buffer
+		G_io_apdu_buffer[APDU_OFF_CLA] = (data[offset + REQUEST_OPTIONS_OFFSET] & CHAINED_REQUEST_OPTION) ? CHAINED_REQUEST_CLASS : REQUEST_CLASS;
+		G_io_apdu_buffer[APDU_OFF_INS] = data[offset + REQUEST_INSTRUCTION_OFFSET];
+		G_io_apdu_buffer[APDU_OFF_P1] = data[offset + REQUEST_FIRST_PARAMETER_OFFSET];
+		G_io_apdu_buffer[APDU_OFF_P2] = data[offset + REQUEST_SECOND_PARAMETER_OFFSET];
+		G_io_apdu_buffer[APDU_OFF_LC] = dataLength;
+		memcpy(&G_io_apdu_buffer[APDU_OFF_DATA], &data[offset + REQUEST_HEADER_SIZE], dataLength);
+
+		// Get request's instruction and if it would be approved
+		const enum Instruction instruction = G_io_apdu_buffer[APDU_OFF_INS];
+		const bool isApproved = data[offset + REQUEST_OPTIONS_OFFSET] & APPROVE_USER_INTERACTION_OPTION;
+
+		// Initialize response flags
+		volatile unsigned char responseFlags = 0;
+
+		// Begin try
+		BEGIN_TRY {
+
+			// Try
+			TRY {
+
+				// Process request
+				volatile unsigned short responseLength = 0;
+				processRequest(APDU_OFF_DATA + dataLength, &responseLength, &responseFlags);
+			}
+
+			// Catch other errors
+			CATCH_OTHER(error) {
+
+				// Check error type
+				switch(error & ERROR_TYPE_MASK) {
+
+					// Lower application errors
+					case ERR_APP_RANGE_01:
+					case ERR_APP_RANGE_02:
+
+						// Reset state
+						resetState();
+
+						// Break
+						break;
+				}
+
+				// Clear menu buffers
+				clearMenuBuffers();
+			}
+
+			// Finally
+			FINALLY {
+			}
+		}
+
+		// End try
+		END_TRY;
+
+		// Check if request is waiting for a user interaction
+		if(responseFlags & IO_ASYNCH_REPLY) {
+
+			// Begin try
+			BEGIN_TRY {
+
+				// Try
+				TRY {
+
+					// Process user interaction
+					processUserInteraction(instruction, isApproved, false);
+				}
+
+				// Catch all errors
+				CATCH_ALL {
+				}
+
+				// Finally
+				FINALLY {
+
+					// Clear menu buffers
+					clearMenuBuffers();
+				}
+			}
+
+			// End try
+			END_TRY;
+		}
+
+		// Check if taking a snapshot after the request
+		if(data[offset + REQUEST_OPTIONS_OFFSET] & TAKE_SNAPSHOT_OPTION) {
+
+			// Take latest snapshot
+			takeSnapshot(&latestSnapshot);
+
+			// Check if the save snapshot isn't the start snapshot so that the start snapshot stays the same for the whole input
+			if(saveSnapshotIndex + 1 != startSnapshotIndex) {
+
+				// Save the latest snapshot so that later inputs can start from it
+				saveSnapshot(saveSnapshotIndex);
+			}
+		}
+
+		// Go to the next request
+		offset += REQUEST_HEADER_SIZE + dataLength;
+	}
+
+	// Cleanup
+	os_boot();
+
+	// Return success
+	return 0;
+}
+
+// Fuzz custom mutator
+size_t LLVMFuzzerCustomMutator(uint8_t *data, size_t size, const size_t maxSize, const unsigned int seed) {
+
+	// Seed random number generator
+	srand(seed);
+
+	// Get requests in the data
+	size_t offsets[MAXIMUM_NUMBER_OF_REQUESTS];
+	const size_t numberOfRequests = getRequestOffsets(offsets, data, size);
+
+	// Check if no complete requests exist
+	if(!numberOfRequests) {
+
+		// Check if an input header and request header don't fit
+		if(maxSize < INPUT_HEADER_SIZE + REQUEST_HEADER_SIZE) {
+
+			// Return mutating the data's bytes
+			return LLVMFuzzerMutate(data, size, maxSize);
+		}
+
+		// Return replacing the data with an input header and a request without data
+		return replaceRange(data, 0, maxSize, 0, 0, (const uint8_t []){rand(), rand() & OPTIONS_MASK, getRandomInstruction(), 0, 0, 0}, INPUT_HEADER_SIZE + REQUEST_HEADER_SIZE);
+	}
+
+	// Get random request
+	const size_t offset = offsets[rand() % numberOfRequests];
+	const size_t length = getRequestLength(data, offset);
+
+	// Check which mutation to perform
+	switch(rand() % 8) {
+
+		// Mutate data
+		case 0: {
+
+			// Mutate a copy of the request's data
+			uint8_t requestData[UINT8_MAX];
+			memcpy(requestData, &data[offset + REQUEST_HEADER_SIZE], length - REQUEST_HEADER_SIZE);
+			const size_t requestDataLength = LLVMFuzzerMutate(requestData, length - REQUEST_HEADER_SIZE, MIN(sizeof(requestData), maxSize - size + length - REQUEST_HEADER_SIZE));
+
+			// Replace request's data with the mutated data
+			data[offset + REQUEST_DATA_LENGTH_OFFSET] = requestDataLength;
+			return replaceRange(data, size, maxSize, offset + REQUEST_HEADER_SIZE, length - REQUEST_HEADER_SIZE, requestData, requestDataLength);
+		}
+
+		// Change instruction
+		case 1:
+
+			// Set request's instruction to a random instruction
+			data[offset + REQUEST_INSTRUCTION_OFFSET] = getRandomInstruction();
+
+			// Return size
+			return size;
+
+		// Change options
+		case 2:
+
+			// Toggle a random option in the request
+			data[offset + REQUEST_OPTIONS_OFFSET] ^= OPTIONS_MASK & (1 << (rand() % 4));
+
+			// Return size
+			return size;
+
+		// Change parameters
+		case 3:
+
+			// Set a random parameter in the request to a small or random value
+			data[offset + ((rand() % 2) ? REQUEST_FIRST_PARAMETER_OFFSET : REQUEST_SECOND_PARAMETER_OFFSET)] = (rand() % 2) ? rand() % 4 : rand();
+
+			// Return size
+			return size;
+
+		// Duplicate request
+		case 4: {
+
+			// Insert a copy of the request after a random request
+			uint8_t request[REQUEST_HEADER_SIZE + UINT8_MAX];
+			memcpy(request, &data[offset], length);
+			const size_t insertOffset = offsets[rand() % numberOfRequests];
+			return replaceRange(data, size, maxSize, insertOffset + getRequestLength(data, insertOffset), 0, request, length);
+		}
+
+		// Remove request
+		case 5:
+
+			// Return removing the request
+			return replaceRange(data, size, maxSize, offset, length, NULL, 0);
+
+		// Change input header
+		case 6:
+
+			// Set input header to select a random start snapshot and save snapshot
+			data[0] = rand();
+
+			// Return size
+			return size;
+
+		// Default
+		default:
+
+			// Return mutating the data's bytes
+			return LLVMFuzzerMutate(data, size, maxSize);
+	}
+}
+
+// Get request offsets
+size_t getRequestOffsets(size_t *offsets, uint8_t *data, const size_t size) {
+
+	// Go through all complete request headers in the data
+	size_t numberOfRequests = 0;
+	for(size_t offset = INPUT_HEADER_SIZE; offset + REQUEST_HEADER_SIZE <= size && numberOfRequests < MAXIMUM_NUMBER_OF_REQUESTS; offset += getRequestLength(data, offset)) {
+
+		// Limit request's data length to the data that's available
+		data[offset + REQUEST_DATA_LENGTH_OFFSET] = MIN(data[offset + REQUEST_DATA_LENGTH_OFFSET], size - offset - REQUEST_HEADER_SIZE);
+
+		// Append request's offset to the offsets
+		offsets[numberOfRequests++] = offset;
+	}
+
+	// Return number of requests
+	return numberOfRequests;
+}
+
+// Get request length
+size_t getRequestLength(const uint8_t *data, const size_t offset) {
+
+	// Return request's length
+	return REQUEST_HEADER_SIZE + data[offset + REQUEST_DATA_LENGTH_OFFSET];
+}
+
+// Replace range
+size_t replaceRange(uint8_t *data, const size_t size, const size_t maxSize, const size_t offset, const size_t length, const uint8_t *replacement, const size_t replacementLength) {
+
+	// Check if the result wouldn't fit
+	if(size - length + replacementLength > maxSize) {
+
+		// Return size
+		return size;
+	}
+
+	// Move data after the range to after the replacement
+	memmove(&data[offset + replacementLength], &data[offset + length], size - offset - length);
+
+	// Check if replacement exists
+	if(replacement) {
+
+		// Copy replacement into the range
+		memcpy(&data[offset], replacement, replacementLength);
+	}
+
+	// Return new size
+	return size - length + replacementLength;
+}
+
+// Get random instruction
+uint8_t getRandomInstruction(void) {
+
+	// Get random instruction including the get response instruction
+	const uint8_t instruction = rand() % (BATCH_INSTRUCTION + 2);
+
+	// Return instruction
+	return (instruction > BATCH_INSTRUCTION) ? GET_RESPONSE_INSTRUCTION : instruction;
+}
+
+// Reset application
+void resetApplication(void) {
+
+	// Reset state
+	resetState();
+	resetChainedApdu();
+	resetRootPublicKeyCache();
+	os_boot();
+	initializeStorage();
+	clearMenuBuffers();
+}
+
+// Save snapshot
+void saveSnapshot(const size_t index) {
+
+	// Copy the latest snapshot and the current requests that reach it into the saved snapshot
+	memcpy(&savedSnapshots[index].snapshot, &latestSnapshot, sizeof(latestSnapshot));
+	memcpy(savedSnapshots[index].requests, currentRequests, currentRequestsSize);
+	savedSnapshots[index].requestsSize = currentRequestsSize;
+	savedSnapshots[index].numberOfRequests = numberOfCurrentRequests;
+
+	// Set that the saved snapshot exists
+	savedSnapshots[index].exists = true;
+
+	// Check if saved snapshots directory is provided
+	const char *directory = getenv(SAVED_SNAPSHOTS_DIRECTORY_ENVIRONMENT_VARIABLE);
+	if(directory) {
+
+		// Check if opening the saved snapshot's file in the directory was successful
+		char path[FILENAME_MAX];
+		snprintf(path, sizeof(path), "%s/%zu", directory, index + 1);
+		FILE *file = fopen(path, "wb");
+		if(file) {
+
+			// Write an input that starts from the initial snapshot and reaches the saved snapshot to the file
+			fputc(0, file);
+			fwrite(currentRequests, sizeof(currentRequests[0]), currentRequestsSize, file);
+
+			// Close file
+			fclose(file);
+		}
+	}
+}
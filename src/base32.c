@@ -12,15 +12,33 @@
 // Padding character
 #define PADDING_CHARACTER '='
 
+// Bytes per group
+#define BYTES_PER_GROUP 5
+
+// Characters per group
+#define CHARACTERS_PER_GROUP 8
+
+// Character mask
+#define CHARACTER_MASK 0b11111
+
+// Invalid character value
+#define INVALID_CHARACTER_VALUE -1
+
 
 // Constants
 
 // Characters
 static const char CHARACTERS[] = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '2', '3', '4', '5', '6', '7'};
 
+// Character values
+static const int8_t CHARACTER_VALUES[] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 26, 27, 28, 29, 30, 31, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1};
+
 
 // Function prototypes
 
+// Base32 decode get length
+static size_t base32DecodeGetLength(uint8_t *result, const size_t resultSize, const char *data, const size_t length);
+
 // Get number of padding characters
 static size_t getNumberOfPaddingCharacters(const size_t length);
 
@@ -35,233 +53,120 @@ size_t getBase32EncodedLength(const size_t length) {
 }
 
 // Base32 encode
-void base32Encode(char *result, const uint8_t *data, const size_t length) {
-
-	// Get number of padding characters
-	const size_t numberOfPaddingCharacters = getNumberOfPaddingCharacters(length);
-
-	// Get number of characters
-	const size_t numberOfCharacters = getBase32EncodedLength(length) - numberOfPaddingCharacters;
-
-	// Go through all characters
-	size_t index;
-	for(index = 0; index < numberOfCharacters; ++index) {
-
-		// Get position in the data
-		const size_t position = index * BITS_PER_CHARACTER / BITS_IN_A_BYTE;
-
-		// Get first byte
-		const uint8_t firstByte = data[position];
-
-		// Get second byte
-		const uint8_t secondByte = (position + 1 < length) ? data[position + 1] : 0;
-
-		// Check byte position in group
-		uint8_t quantum;
-		switch(index % BITS_IN_A_BYTE) {
-
-			// Zero
-			case 0:
-
-				// Set quantum
-				quantum = (firstByte & 0b11111000) >> 3;
-
-				// Break
-				break;
-
-			// One
-			case 1:
+size_t base32Encode(char *result, const uint8_t *data, const size_t length) {
 
-				// Set quantum
-				quantum = ((firstByte & 0b00000111) << 2) | ((secondByte & 0b11000000) >> 6);
+	// Go through all groups in the data
+	size_t numberOfCharacters = 0;
+	for(size_t i = 0; i < length; i += BYTES_PER_GROUP) {
 
-				// Break
-				break;
+		// Get number of bytes in the group
+		const size_t numberOfBytes = MIN(length - i, BYTES_PER_GROUP);
 
-			// Two
-			case 2:
+		// Go through all bytes in the group
+		uint64_t value = 0;
+		for(size_t j = 0; j < BYTES_PER_GROUP; ++j) {
 
-				// Set quantum
-				quantum = (firstByte & 0b00111110) >> 1;
-
-				// Break
-				break;
-
-			// Three
-			case 3:
-
-				// Set quantum
-				quantum = ((firstByte & 0b00000001) << 4) | ((secondByte & 0b11110000) >> 4);
-
-				// Break
-				break;
-
-			// Four
-			case 4:
-
-				// Set quantum
-				quantum = ((firstByte & 0b00001111) << 1) | ((secondByte & 0b10000000) >> 7);
-
-				// Break
-				break;
-
-			// Five
-			case 5:
-
-				// Set quantum
-				quantum = (firstByte & 0b01111100) >> 2;
-
-				// Break
-				break;
-
-			// Six
-			case 6:
-
-				// Set quantum
-				quantum = ((firstByte & 0b00000011) << 3) | ((secondByte & 0b11100000) >> 5);
-
-				// Break
-				break;
-
-			// Seven
-			case 7:
+			// Include byte or zero padding in the value
+			value = (value << BITS_IN_A_BYTE) | ((j < numberOfBytes) ? data[i + j] : 0);
+		}
 
-				// Set quantum
-				quantum = firstByte & 0b00011111;
+		// Go through all characters that represent the group's bytes
+		for(size_t j = 0; j < (numberOfBytes * BITS_IN_A_BYTE + BITS_PER_CHARACTER - 1) / BITS_PER_CHARACTER; ++j) {
 
-				// Break
-				break;
+			// Append quantum as a character to the result
+			result[numberOfCharacters++] = CHARACTERS[(value >> ((CHARACTERS_PER_GROUP - 1 - j) * BITS_PER_CHARACTER)) & CHARACTER_MASK];
 		}
-
-		// Append quantum as a character to the result
-		result[index] = CHARACTERS[quantum];
 	}
 
-	// Go through all padding characters
-	for(size_t i = 0; i < numberOfPaddingCharacters; ++i) {
+	// Append padding characters to the result
+	const size_t numberOfPaddingCharacters = getNumberOfPaddingCharacters(length);
+	memset(&result[numberOfCharacters], PADDING_CHARACTER, numberOfPaddingCharacters);
 
-		// Append padding character to the result
-		result[index + i] = PADDING_CHARACTER;
-	}
+	// Return result length
+	return numberOfCharacters + numberOfPaddingCharacters;
 }
 
 // Get base32 decoded length
 size_t getBase32DecodedLength(const char *data, const size_t length) {
 
-	// Get start of padding in the data
-	const char *startOfPadding = memchr(data, PADDING_CHARACTER, length);
+	// Return base32 decoded length
+	return base32DecodeGetLength(NULL, 0, data, length);
+}
 
-	// Go through all padding
-	for(const char *i = startOfPadding; i && i != data + length; ++i) {
+// Base32 decode
+size_t base32Decode(uint8_t *result, const size_t resultSize, const char *data, const size_t length) {
 
-		// Check if padding isn't a padding character
-		if(*i != PADDING_CHARACTER) {
+	// Return getting base32 decoding of the data
+	return base32DecodeGetLength(result, resultSize, data, length);
+}
 
-			// Return invalid base32 size
-			return INVALID_BASE32_SIZE;
-		}
+// Base32 decode get length
+size_t base32DecodeGetLength(uint8_t *result, const size_t resultSize, const char *data, const size_t length) {
+
+	// Go through all padding characters at the end of the data
+	size_t numberOfCharacters = length;
+	while(numberOfCharacters && data[numberOfCharacters - 1] == PADDING_CHARACTER) {
+
+		// Decrement number of characters
+		--numberOfCharacters;
 	}
 
 	// Get number of bytes
-	const size_t numberOfBytes = (startOfPadding ? startOfPadding - data : length) * BITS_PER_CHARACTER / BITS_IN_A_BYTE;
+	const size_t numberOfBytes = numberOfCharacters * BITS_PER_CHARACTER / BITS_IN_A_BYTE;
 
-	// Check if the number of padding characters is invalid
-	const size_t numberOfPaddingCharacters = getNumberOfPaddingCharacters(numberOfBytes);
-	if(numberOfPaddingCharacters != (size_t)(startOfPadding ? data + length - startOfPadding : 0)) {
+	// Check if the number of padding characters is invalid or the result doesn't fit in the result
+	if(getNumberOfPaddingCharacters(numberOfBytes) != length - numberOfCharacters || (result && numberOfBytes > resultSize)) {
 
 		// Return invalid base32 size
 		return INVALID_BASE32_SIZE;
 	}
 
-	// Go through all non-padding characters
-	for(size_t i = 0; i < length - numberOfPaddingCharacters; ++i) {
-
-		// Check if character isn't a valid character
-		if(!memchr(CHARACTERS, data[i], sizeof(CHARACTERS))) {
-
-			// Return invalid base32 size
-			return INVALID_BASE32_SIZE;
-		}
-	}
-
-	// Return number of bytes
-	return numberOfBytes;
-}
-
-// Base32 decode
-void base32Decode(uint8_t *result, const char *data, const size_t length) {
-
-	// Get number of bytes
-	const size_t numberOfBytes = getBase32DecodedLength(data, length);
-
-	// Go through all bytes
-	for(size_t i = 0; i < numberOfBytes; ++i) {
-
-		// Get position in the data
-		const size_t position = i * BITS_IN_A_BYTE / BITS_PER_CHARACTER;
-
-		// Get first quantum
-		const char firstQuantum = (char *)memchr(CHARACTERS, data[position], sizeof(CHARACTERS)) - CHARACTERS;
-
-		// Get second quantum
-		const char secondQuantum = (position + 1 < length) ? (char *)memchr(CHARACTERS, data[position + 1], sizeof(CHARACTERS)) - CHARACTERS : 0;
-
-		// Get third quantum
-		const char thirdQuantum = (position + 2 < length) ? (char *)memchr(CHARACTERS, data[position + 2], sizeof(CHARACTERS)) - CHARACTERS : 0;
-
-		// Check quantum position in group
-		uint8_t byte;
-		switch(i % BITS_PER_CHARACTER) {
-
-			// Zero
-			case 0:
+	// Go through all groups in the data
+	for(size_t i = 0, j = 0; i < numberOfCharacters; i += CHARACTERS_PER_GROUP, j += BYTES_PER_GROUP) {
 
-				// Set byte
-				byte = ((firstQuantum & 0b11111) << 3) | ((secondQuantum & 0b11100) >> 2);
+		// Go through all characters in the group
+		uint64_t value = 0;
+		for(size_t k = 0; k < CHARACTERS_PER_GROUP; ++k) {
 
-				// Break
-				break;
+			// Check if character is padding
+			if(i + k >= numberOfCharacters) {
 
-			// One
-			case 1:
+				// Include zero padding in the value
+				value <<= BITS_PER_CHARACTER;
+			}
 
-				// Set byte
-				byte = ((firstQuantum & 0b00011) << 6) | ((secondQuantum & 0b11111) << 1) | ((thirdQuantum & 0b10000) >> 4);
+			// Otherwise
+			else {
 
-				// Break
-				break;
+				// Get character's value
+				const int8_t characterValue = ((uint8_t)data[i + k] < sizeof(CHARACTER_VALUES)) ? CHARACTER_VALUES[(uint8_t)data[i + k]] : INVALID_CHARACTER_VALUE;
 
-			// Two
-			case 2:
+				// Check if character is invalid
+				if(characterValue == INVALID_CHARACTER_VALUE) {
 
-				// Set byte
-				byte = ((firstQuantum & 0b01111) << 4) | ((secondQuantum & 0b11110) >> 1);
+					// Return invalid base32 size
+					return INVALID_BASE32_SIZE;
+				}
 
-				// Break
-				break;
-
-			// Three
-			case 3:
-
-				// Set byte
-				byte = ((firstQuantum & 0b00001) << 7) | ((secondQuantum & 0b11111) << 2) | ((thirdQuantum & 0b11000) >> 3);
-
-				// Break
-				break;
+				// Include character's value in the value
+				value = (value << BITS_PER_CHARACTER) | characterValue;
+			}
+		}
 
-			// Four
-			case 4:
+		// Check if getting result
+		if(result) {
 
-				// Set byte
-				byte = ((firstQuantum & 0b00111) << 5) | (secondQuantum & 0b11111);
+			// Go through all bytes that the group represents
+			for(size_t k = 0; k < BYTES_PER_GROUP && j + k < numberOfBytes; ++k) {
 
-				// Break
-				break;
+				// Append byte to the result
+				result[j + k] = value >> ((BYTES_PER_GROUP - 1 - k) * BITS_IN_A_BYTE);
+			}
 		}
-
-		// Append byte to the result
-		result[i] = byte;
 	}
+
+	// Return number of bytes
+	return numberOfBytes;
 }
 
 // Get number of padding characters
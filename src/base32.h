@@ -20,13 +20,13 @@
 size_t getBase32EncodedLength(const size_t length);
 
 // Base32 encode
-void base32Encode(char *result, const uint8_t *data, const size_t length);
+size_t base32Encode(char *result, const uint8_t *data, const size_t length);
 
 // Get base32 decoded length
 size_t getBase32DecodedLength(const char *data, const size_t length);
 
 // Base32 decode
-void base32Decode(uint8_t *result, const char *data, const size_t length);
+size_t base32Decode(uint8_t *result, const size_t resultSize, const char *data, const size_t length);
 
 
 #endif
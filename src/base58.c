@@ -16,12 +16,27 @@
 // Size percent decrease
 #define SIZE_PERCENT_DECREASE 733
 
+// Digits per limb
+#define DIGITS_PER_LIMB 5
+
+// Limb number base
+#define LIMB_NUMBER_BASE (NUMBER_BASE * NUMBER_BASE * NUMBER_BASE * NUMBER_BASE * NUMBER_BASE)
+
+// Bytes per limb
+#define BYTES_PER_LIMB sizeof(uint32_t)
+
+// Invalid character value
+#define INVALID_CHARACTER_VALUE -1
+
 
 // Constants
 
 // Characters
 static const char CHARACTERS[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'J', 'K', 'L', 'M', 'N', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z'};
 
+// Character values
+static const int8_t CHARACTER_VALUES[] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 6, 7, 8, -1, -1, -1, -1, -1, -1, -1, 9, 10, 11, 12, 13, 14, 15, 16, -1, 17, 18, 19, 20, 21, -1, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, -1, -1, -1, -1, -1, -1, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, -1, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, -1, -1, -1, -1, -1};
+
 
 // Function prototypes
 
@@ -29,7 +44,7 @@ static const char CHARACTERS[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9', '
 static size_t base58EncodeGetLength(char *result, const uint8_t *data, const size_t length);
 
 // Base58 decode get length
-static size_t base58DecodeGetLength(uint8_t *result, const char *data, const size_t length);
+static size_t base58DecodeGetLength(uint8_t *result, const size_t resultSize, const char *data, const size_t length);
 
 // Get checksum
 static void getChecksum(uint8_t *checksum, const uint8_t *data, const size_t length);
@@ -45,10 +60,10 @@ size_t getBase58EncodedLength(const uint8_t *data, const size_t length) {
 }
 
 // Base58 encode
-void base58Encode(char *result, const uint8_t *data, const size_t length) {
+size_t base58Encode(char *result, const uint8_t *data, const size_t length) {
 
-	// Get base58 encoding of the data
-	base58EncodeGetLength(result, data, length);
+	// Return getting base58 encoding of the data
+	return base58EncodeGetLength(result, data, length);
 }
 
 // Get base58 encoded length with checksum
@@ -59,51 +74,56 @@ size_t getBase58EncodedLengthWithChecksum(const uint8_t *data, const size_t leng
 }
 
 // Base58 encode with checksum
-void base58EncodeWithChecksum(char *result, uint8_t *data, const size_t length) {
+size_t base58EncodeWithChecksum(char *result, uint8_t *data, const size_t length) {
 
 	// Append checksum to the data
 	getChecksum(&data[length - BASE58_CHECKSUM_SIZE], data, length - BASE58_CHECKSUM_SIZE);
 
-	// Get base58 encoding of the data
-	base58EncodeGetLength(result, data, length);
+	// Return getting base58 encoding of the data
+	return base58EncodeGetLength(result, data, length);
 }
 
 // Get base58 decoded length
 size_t getBase58DecodedLength(const char *data, const size_t length) {
 
 	// Return base58 decoded length
-	return base58DecodeGetLength(NULL, data, length);
+	return base58DecodeGetLength(NULL, 0, data, length);
 }
 
 // Base58 decode
-void base58Decode(uint8_t *result, const char *data, const size_t length) {
+size_t base58Decode(uint8_t *result, const size_t resultSize, const char *data, const size_t length) {
 
-	// Get base58 decoding of the data
-	base58DecodeGetLength(result, data, length);
+	// Return getting base58 decoding of the data
+	return base58DecodeGetLength(result, resultSize, data, length);
 }
 
 // Get base58 decoded length with checksum
 size_t getBase58DecodedLengthWithChecksum(const char *data, const size_t length) {
 
 	// Get base58 decoded length
-	const size_t resultLength = base58DecodeGetLength(NULL, data, length);
+	const size_t resultLength = base58DecodeGetLength(NULL, 0, data, length);
 
 	// Return base58 decoded length with checksum if valid
 	return (resultLength >= BASE58_CHECKSUM_SIZE) ? resultLength : INVALID_BASE58_SIZE;
 }
 
 // Base58 decode with checksum
-bool base58DecodeWithChecksum(uint8_t *result, const char *data, const size_t length) {
+size_t base58DecodeWithChecksum(uint8_t *result, const size_t resultSize, const char *data, const size_t length) {
 
-	// Get base58 decoding of the data
-	const size_t resultLength = base58DecodeGetLength(result, data, length);
+	// Check if getting base58 decoding of the data failed or it doesn't include a checksum
+	const size_t resultLength = base58DecodeGetLength(result, resultSize, data, length);
+	if(resultLength == INVALID_BASE58_SIZE || resultLength < BASE58_CHECKSUM_SIZE) {
+
+		// Return invalid base58 size
+		return INVALID_BASE58_SIZE;
+	}
 
 	// Get checksum of the result
 	uint8_t checksum[BASE58_CHECKSUM_SIZE];
 	getChecksum(checksum, result, resultLength - BASE58_CHECKSUM_SIZE);
 
-	// Return if the checksum matches the expected result
-	return !memcmp(&result[resultLength - BASE58_CHECKSUM_SIZE], checksum, sizeof(checksum));
+	// Return result length if the checksum matches the expected result
+	return memcmp(&result[resultLength - BASE58_CHECKSUM_SIZE], checksum, sizeof(checksum)) ? INVALID_BASE58_SIZE : resultLength;
 }
 
 // Base58 encode get length
@@ -117,58 +137,62 @@ size_t base58EncodeGetLength(char *result, const uint8_t *data, const size_t len
 		++numberOfLeadingZeros;
 	}
 
-	// Get buffer size
-	const size_t bufferSize = (length - numberOfLeadingZeros) * SIZE_PERCENT_INCREASE / 100 + 1;
-
-	// Create buffer
-	uint8_t *buffer = alloca(bufferSize);
-	explicit_bzero(buffer, bufferSize);
+	// Get maximum number of limbs
+	const size_t maximumNumberOfLimbs = ((length - numberOfLeadingZeros) * SIZE_PERCENT_INCREASE / 100 + 1 + DIGITS_PER_LIMB - 1) / DIGITS_PER_LIMB;
 
-	// Go through all bytes in the byte array after the leading zeros
-	size_t currentLength = 0;
-	for(size_t i = numberOfLeadingZeros; i < length; ++i) {
+	// Create limbs
+	uint32_t *limbs = alloca(maximumNumberOfLimbs * sizeof(uint32_t));
 
-		// Get byte
-		uint8_t byte = data[i];
+	// Go through all groups of bytes in the data after the leading zeros, starting with a group that aligns the rest to limb boundaries
+	size_t numberOfLimbs = 0;
+	for(size_t i = numberOfLeadingZeros, groupLength = (length - numberOfLeadingZeros) % BYTES_PER_LIMB ? (length - numberOfLeadingZeros) % BYTES_PER_LIMB : BYTES_PER_LIMB; i < length; i += groupLength, groupLength = BYTES_PER_LIMB) {
 
-		// Go through all base 58 components of the byte
-		size_t j = 0;
-		for(size_t k = bufferSize - 1; byte || j < currentLength; --k) {
+		// Get group's value
+		uint32_t value = 0;
+		for(size_t j = 0; j < groupLength; ++j) {
 
-			// Include the current buffer value in the byte
-			const uint16_t value = byte + (UINT8_MAX + 1) * buffer[k];
+			// Include byte in the value
+			value = (value << BITS_IN_A_BYTE) | data[i + j];
+		}
 
-			// Set value in the buffer
-			buffer[k] = value % NUMBER_BASE;
+		// Get group's base
+		const uint64_t groupBase = (uint64_t)1 << (groupLength * BITS_IN_A_BYTE);
 
-			// Update the byte
-			byte = value / NUMBER_BASE;
+		// Go through all limbs
+		uint64_t carry = value;
+		for(size_t j = 0; j < numberOfLimbs; ++j) {
 
-			// Increment j
-			++j;
+			// Multiply the limb by the group's base and add the carry to it
+			const uint64_t product = limbs[j] * groupBase + carry;
 
-			// Check if at the last component
-			if(!k) {
+			// Set limb to the product's low part
+			limbs[j] = product % LIMB_NUMBER_BASE;
 
-				// Break
-				break;
-			}
+			// Set carry to the product's high part
+			carry = product / LIMB_NUMBER_BASE;
 		}
 
-		// Update current length
-		currentLength = j;
+		// Go through all remaining parts of the carry
+		while(carry && numberOfLimbs < maximumNumberOfLimbs) {
+
+			// Append carry's low part as a new limb
+			limbs[numberOfLimbs++] = carry % LIMB_NUMBER_BASE;
+
+			// Remove low part from the carry
+			carry /= LIMB_NUMBER_BASE;
+		}
 	}
 
-	// Go through all leading zeros in the buffer
-	size_t bufferIndex = bufferSize - currentLength;
-	while(bufferIndex < bufferSize && !buffer[bufferIndex]) {
+	// Get number of digits in the most significant limb
+	size_t numberOfMostSignificantDigits = 0;
+	for(uint32_t value = numberOfLimbs ? limbs[numberOfLimbs - 1] : 0; value; value /= NUMBER_BASE) {
 
-		// Increment buffer index
-		++bufferIndex;
+		// Increment number of most significant digits
+		++numberOfMostSignificantDigits;
 	}
 
 	// Get result size
-	const size_t resultSize = bufferSize - bufferIndex + numberOfLeadingZeros;
+	const size_t resultSize = numberOfLeadingZeros + (numberOfLimbs ? (numberOfLimbs - 1) * DIGITS_PER_LIMB + numberOfMostSignificantDigits : 0);
 
 	// Check if getting result
 	if(result) {
@@ -176,11 +200,19 @@ size_t base58EncodeGetLength(char *result, const uint8_t *data, const size_t len
 		// Set result to start with the number of leading zeros in base58
 		memset(result, CHARACTERS[0], numberOfLeadingZeros);
 
-		// Go through all bytes in the buffer after the leading zeros
-		for(size_t i = 0; bufferIndex < bufferSize; ++i, ++bufferIndex) {
+		// Go through all limbs from least significant to most significant
+		for(size_t i = 0, j = resultSize; i < numberOfLimbs; ++i) {
+
+			// Go through all digits in the limb
+			uint32_t value = limbs[i];
+			for(size_t k = 0; k < ((i == numberOfLimbs - 1) ? numberOfMostSignificantDigits : DIGITS_PER_LIMB); ++k) {
+
+				// Prepend digit in base58 to the result
+				result[--j] = CHARACTERS[value % NUMBER_BASE];
 
-			// Append buffer's value in base58 to the result
-			result[i + numberOfLeadingZeros] = CHARACTERS[buffer[bufferIndex]];
+				// Remove digit from the value
+				value /= NUMBER_BASE;
+			}
 		}
 	}
 
@@ -189,7 +221,7 @@ size_t base58EncodeGetLength(char *result, const uint8_t *data, const size_t len
 }
 
 // Base58 decode get length
-size_t base58DecodeGetLength(uint8_t *result, const char *data, const size_t length) {
+size_t base58DecodeGetLength(uint8_t *result, const size_t resultSize, const char *data, const size_t length) {
 
 	// Go through all leading zeros in base58 in the string
 	size_t numberOfLeadingZeros = 0;
@@ -199,85 +231,105 @@ size_t base58DecodeGetLength(uint8_t *result, const char *data, const size_t len
 		++numberOfLeadingZeros;
 	}
 
-	// Get buffer size
-	const size_t bufferSize = (length - numberOfLeadingZeros) * SIZE_PERCENT_DECREASE / 1000 + 1;
+	// Get maximum number of limbs
+	const size_t maximumNumberOfLimbs = ((length - numberOfLeadingZeros) * SIZE_PERCENT_DECREASE / 1000 + 1 + BYTES_PER_LIMB - 1) / BYTES_PER_LIMB;
 
-	// Create buffer
-	uint8_t *buffer = alloca(bufferSize);
-	explicit_bzero(buffer, bufferSize);
+	// Create limbs
+	uint32_t *limbs = alloca(maximumNumberOfLimbs * sizeof(uint32_t));
 
-	// Go through all characters in the string after the leading zeros in base58
-	size_t currentLength = 0;
-	for(size_t i = numberOfLeadingZeros; i < length; ++i) {
+	// Go through all groups of characters in the string after the leading zeros in base58, starting with a group that aligns the rest to limb boundaries
+	size_t numberOfLimbs = 0;
+	for(size_t i = numberOfLeadingZeros, groupLength = (length - numberOfLeadingZeros) % DIGITS_PER_LIMB ? (length - numberOfLeadingZeros) % DIGITS_PER_LIMB : DIGITS_PER_LIMB; i < length; i += groupLength, groupLength = DIGITS_PER_LIMB) {
 
-		// Get position of character in the characters
-		const char *characterOffset = (char *)memchr(CHARACTERS, data[i], sizeof(CHARACTERS));
+		// Get group's value and base
+		uint32_t value = 0;
+		uint32_t groupBase = 1;
+		for(size_t j = 0; j < groupLength; ++j) {
 
-		// Check if character is invalid
-		if(!characterOffset) {
+			// Get character's value
+			const int8_t characterValue = ((uint8_t)data[i + j] < sizeof(CHARACTER_VALUES)) ? CHARACTER_VALUES[(uint8_t)data[i + j]] : INVALID_CHARACTER_VALUE;
 
-			// Return invalid base58 size
-			return INVALID_BASE58_SIZE;
-		}
+			// Check if character is invalid
+			if(characterValue == INVALID_CHARACTER_VALUE) {
 
-		// Get character as byte
-		uint8_t byte = characterOffset - CHARACTERS;
-
-		// Go through all base 58 components of the byte
-		size_t j = 0;
-		for(size_t k = bufferSize - 1; byte || j < currentLength; --k) {
+				// Return invalid base58 size
+				return INVALID_BASE58_SIZE;
+			}
 
-			// Include the current buffer value in the byte
-			const uint16_t value = byte + NUMBER_BASE * buffer[k];
+			// Include character's value in the value
+			value = value * NUMBER_BASE + characterValue;
 
-			// Set value in the buffer
-			buffer[k] = value % (UINT8_MAX + 1);
+			// Update group base
+			groupBase *= NUMBER_BASE;
+		}
 
-			// Update the byte
-			byte = value / (UINT8_MAX + 1);
+		// Go through all limbs
+		uint64_t carry = value;
+		for(size_t j = 0; j < numberOfLimbs; ++j) {
 
-			// Increment j
-			++j;
+			// Multiply the limb by the group's base and add the carry to it
+			const uint64_t product = (uint64_t)limbs[j] * groupBase + carry;
 
-			// Check if at the last component
-			if(!k) {
+			// Set limb to the product's low part
+			limbs[j] = product;
 
-				// Break
-				break;
-			}
+			// Set carry to the product's high part
+			carry = product >> (BYTES_PER_LIMB * BITS_IN_A_BYTE);
 		}
 
-		// Update current length
-		currentLength = j;
+		// Go through all remaining parts of the carry
+		while(carry && numberOfLimbs < maximumNumberOfLimbs) {
+
+			// Append carry's low part as a new limb
+			limbs[numberOfLimbs++] = carry;
+
+			// Remove low part from the carry
+			carry >>= BYTES_PER_LIMB * BITS_IN_A_BYTE;
+		}
 	}
 
-	// Go through all leading zeros in the buffer
-	size_t bufferIndex = bufferSize - currentLength;
-	while(bufferIndex < bufferSize && !buffer[bufferIndex]) {
+	// Get number of bytes in the most significant limb
+	size_t numberOfMostSignificantBytes = 0;
+	for(uint32_t value = numberOfLimbs ? limbs[numberOfLimbs - 1] : 0; value; value >>= BITS_IN_A_BYTE) {
 
-		// Increment buffer index
-		++bufferIndex;
+		// Increment number of most significant bytes
+		++numberOfMostSignificantBytes;
 	}
 
-	// Get result size
-	const size_t resultSize = bufferSize - bufferIndex + numberOfLeadingZeros;
+	// Get result length
+	const size_t resultLength = numberOfLeadingZeros + (numberOfLimbs ? (numberOfLimbs - 1) * BYTES_PER_LIMB + numberOfMostSignificantBytes : 0);
 
 	// Check if getting result
 	if(result) {
 
+		// Check if result doesn't fit in the result
+		if(resultLength > resultSize) {
+
+			// Return invalid base58 size
+			return INVALID_BASE58_SIZE;
+		}
+
 		// Set result to start with the number of leading zeros
 		explicit_bzero(result, numberOfLeadingZeros);
 
-		// Go through all bytes in the buffer after the leading zeros
-		for(size_t i = 0; bufferIndex < bufferSize; ++i, ++bufferIndex) {
+		// Go through all limbs from least significant to most significant
+		for(size_t i = 0, j = resultLength; i < numberOfLimbs; ++i) {
+
+			// Go through all bytes in the limb
+			uint32_t value = limbs[i];
+			for(size_t k = 0; k < ((i == numberOfLimbs - 1) ? numberOfMostSignificantBytes : BYTES_PER_LIMB); ++k) {
 
-			// Append buffer's value to the result
-			result[i + numberOfLeadingZeros] = buffer[bufferIndex];
+				// Prepend byte to the result
+				result[--j] = value;
+
+				// Remove byte from the value
+				value >>= BITS_IN_A_BYTE;
+			}
 		}
 	}
 
-	// Return result size
-	return resultSize;
+	// Return result length
+	return resultLength;
 }
 
 // Get checksum
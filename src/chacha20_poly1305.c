@@ -3,6 +3,7 @@
 #include <string.h>
 #include "chacha20_poly1305.h"
 #include "common.h"
+#include "performance_counters.h"
 
 
 // Definitions
@@ -13,9 +14,67 @@
 // Poly1305 block size size
 #define POLY1305_BLOCK_SIZE 16
 
+// Poly1305 limb size
+#define POLY1305_LIMB_SIZE 26
+
+// Poly1305 limb mask
+#define POLY1305_LIMB_MASK ((UINT32_C(1) << POLY1305_LIMB_SIZE) - 1)
+
+// Poly1305 block high bit
+#define POLY1305_BLOCK_HIGH_BIT (UINT32_C(1) << 24)
+
 // ChaCha20 key size
 #define CHACHA20_KEY_SIZE 32
 
+// ChaCha20 number of double rounds
+#define CHACHA20_NUMBER_OF_DOUBLE_ROUNDS 10
+
+// Check if AVX2 is available
+#if defined(__AVX2__)
+
+	// ChaCha20 number of parallel blocks
+	#define CHACHA20_NUMBER_OF_PARALLEL_BLOCKS 8
+
+// Otherwise check if SSE2 or NEON is available
+#elif defined(__SSE2__) || defined(__ARM_NEON)
+
+	// ChaCha20 number of parallel blocks
+	#define CHACHA20_NUMBER_OF_PARALLEL_BLOCKS 4
+
+// Otherwise
+#else
+
+	// ChaCha20 number of parallel blocks
+	#define CHACHA20_NUMBER_OF_PARALLEL_BLOCKS 1
+#endif
+
+// ChaCha20 rotate left
+#define CHACHA20_ROTATE_LEFT(value, bits) (((value) << (bits)) | ((value) >> (sizeof(uint32_t) * BITS_IN_A_BYTE - (bits))))
+
+// ChaCha20 quarter round
+#define CHACHA20_QUARTER_ROUND(a, b, c, d) { \
+	(a) += (b); \
+	(d) = CHACHA20_ROTATE_LEFT((d) ^ (a), 16); \
+	(c) += (d); \
+	(b) = CHACHA20_ROTATE_LEFT((b) ^ (c), 12); \
+	(a) += (b); \
+	(d) = CHACHA20_ROTATE_LEFT((d) ^ (a), 8); \
+	(c) += (d); \
+	(b) = CHACHA20_ROTATE_LEFT((b) ^ (c), 7); \
+}
+
+// ChaCha20 double round
+#define CHACHA20_DOUBLE_ROUND(state) { \
+	CHACHA20_QUARTER_ROUND((state)[0], (state)[4], (state)[8], (state)[12]); \
+	CHACHA20_QUARTER_ROUND((state)[1], (state)[5], (state)[9], (state)[13]); \
+	CHACHA20_QUARTER_ROUND((state)[2], (state)[6], (state)[10], (state)[14]); \
+	CHACHA20_QUARTER_ROUND((state)[3], (state)[7], (state)[11], (state)[15]); \
+	CHACHA20_QUARTER_ROUND((state)[0], (state)[5], (state)[10], (state)[15]); \
+	CHACHA20_QUARTER_ROUND((state)[1], (state)[6], (state)[11], (state)[12]); \
+	CHACHA20_QUARTER_ROUND((state)[2], (state)[7], (state)[8], (state)[13]); \
+	CHACHA20_QUARTER_ROUND((state)[3], (state)[4], (state)[9], (state)[14]); \
+}
+
 
 // Constants
 
@@ -25,8 +84,20 @@
 // ChaCha20 state constant
 static const char CHACHA20_STATE_CONSTANT[] = {'e', 'x', 'p', 'a', 'n', 'd', ' ', '3', '2', '-', 'b', 'y', 't', 'e', ' ', 'k'};
 
-// Poly1305 p
-static const uint8_t POLY1305_P[] = {0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB};
+// Check if computing multiple ChaCha20 blocks in parallel
+#if CHACHA20_NUMBER_OF_PARALLEL_BLOCKS > 1
+
+	// ChaCha20 vector
+	typedef uint32_t ChaCha20Vector __attribute__((vector_size(sizeof(uint32_t) * CHACHA20_NUMBER_OF_PARALLEL_BLOCKS)));
+
+	// ChaCha20 lane block counter offsets
+	static const ChaCha20Vector CHACHA20_LANE_BLOCK_COUNTER_OFFSETS = {
+		0, 1, 2, 3,
+	#if CHACHA20_NUMBER_OF_PARALLEL_BLOCKS == 8
+		4, 5, 6, 7,
+	#endif
+	};
+#endif
 
 #endif
 
@@ -36,18 +107,37 @@ static const uint8_t POLY1305_P[] = {0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0
 // Check if not using SDK's version of ChaCha20 Poly1305
 #ifndef HAVE_CHACHA_POLY
 
-// Quarter round
-static void quarterRound(uint32_t *a, uint32_t *b, uint32_t *c, uint32_t *d);
+// Get ChaCha20 blocks
+static void getChaCha20Blocks(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Blocks, const size_t numberOfBlocks);
+
+// Get ChaCha20 block
+static void getChaCha20Block(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Block);
 
-// Rotate left
-static void rotateLeft(uint32_t *value, const size_t bits);
+// Check if computing multiple ChaCha20 blocks in parallel
+#if CHACHA20_NUMBER_OF_PARALLEL_BLOCKS > 1
+
+	// Get parallel ChaCha20 blocks
+	static void getParallelChaCha20Blocks(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Blocks);
+#endif
 
-// Initialize ChaCha20 current state
-static void initializeChaCha20CurrentState(const ChaCha20Poly1305State *chaCha20Poly1305State, uint32_t *chaCha20CurrentState);
+// Apply ChaCha20 keystream
+static void applyChaCha20Keystream(ChaCha20Poly1305State *chaCha20Poly1305State, volatile uint8_t *result, const uint8_t *data, const size_t dataLength);
 
 // Update Poly1305 accumulator
 static void updatePoly1305Accumulator(ChaCha20Poly1305State *chaCha20Poly1305State, const uint8_t *value, const size_t valueLength);
 
+// Process Poly1305 block
+static void processPoly1305Block(ChaCha20Poly1305State *chaCha20Poly1305State, const uint8_t *block);
+
+// Finish Poly1305 accumulator
+static void finishPoly1305Accumulator(ChaCha20Poly1305State *chaCha20Poly1305State, uint8_t *tag);
+
+// Load little endian uint32
+static uint32_t loadLittleEndianUint32(const uint8_t *value);
+
+// Store little endian uint32
+static void storeLittleEndianUint32(uint8_t *result, const uint32_t value);
+
 #endif
 
 
@@ -129,31 +219,25 @@ void initializeChaCha20Poly1305(volatile ChaCha20Poly1305State *chaCha20Poly1305
 			// Try
 			TRY {
 
-				// Initialize ChaCha20 current state with the ChaCha20 Poly1305 state
-				initializeChaCha20CurrentState((ChaCha20Poly1305State *)chaCha20Poly1305State, (uint32_t *)chaCha20CurrentState);
+				// Initialize ChaCha20 current state with the ChaCha20 Poly1305 state's block
+				getChaCha20Blocks((uint32_t *)chaCha20Poly1305State->chaCha20OriginalState, chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX], (uint32_t *)chaCha20CurrentState, 1);
 
 				// Get the Poly1305 key from the ChaCha20 current state
 				const uint8_t *poly1305Key = (uint8_t *)chaCha20CurrentState;
 
-				// Set Poly1305 r to the first part of the ChaCha20 current state
-				memcpy((uint8_t *)chaCha20Poly1305State->poly1305R, poly1305Key, sizeof(chaCha20Poly1305State->poly1305R) - 1);
-				chaCha20Poly1305State->poly1305R[sizeof(chaCha20Poly1305State->poly1305R) - 1] = 0;
-
-				// Clamp Poly1305 r
-				chaCha20Poly1305State->poly1305R[3] &= 15;
-				chaCha20Poly1305State->poly1305R[7] &= 15;
-				chaCha20Poly1305State->poly1305R[11] &= 15;
-				chaCha20Poly1305State->poly1305R[15] &= 15;
-				chaCha20Poly1305State->poly1305R[4] &= 252;
-				chaCha20Poly1305State->poly1305R[8] &= 252;
-				chaCha20Poly1305State->poly1305R[12] &= 252;
-
-				// Convert Poly1305 r to big endian
-				swapEndianness((uint8_t *)&chaCha20Poly1305State->poly1305R, sizeof(chaCha20Poly1305State->poly1305R));
-
-				// Set Poly1305 s to the second part of the ChaCha20 current state
-				memcpy((uint8_t *)chaCha20Poly1305State->poly1305S, &poly1305Key[sizeof(chaCha20Poly1305State->poly1305R) - 1], sizeof(chaCha20Poly1305State->poly1305S) - 1);
-				chaCha20Poly1305State->poly1305S[sizeof(chaCha20Poly1305State->poly1305S) - 1] = 0;
+				// Set Poly1305 r to the clamped first part of the ChaCha20 current state split into 26-bit limbs
+				chaCha20Poly1305State->poly1305R[0] = loadLittleEndianUint32(&poly1305Key[0]) & 0x3FFFFFF;
+				chaCha20Poly1305State->poly1305R[1] = (loadLittleEndianUint32(&poly1305Key[3]) >> 2) & 0x3FFFF03;
+				chaCha20Poly1305State->poly1305R[2] = (loadLittleEndianUint32(&poly1305Key[6]) >> 4) & 0x3FFC0FF;
+				chaCha20Poly1305State->poly1305R[3] = (loadLittleEndianUint32(&poly1305Key[9]) >> 6) & 0x3F03FFF;
+				chaCha20Poly1305State->poly1305R[4] = (loadLittleEndianUint32(&poly1305Key[12]) >> 8) & 0x00FFFFF;
+
+				// Go through all words in the second part of the ChaCha20 current state
+				for(size_t i = 0; i < POLY1305_KEY_PART_NUMBER_OF_WORDS; ++i) {
+
+					// Set Poly1305 s word to the little endian word in the ChaCha20 current state
+					chaCha20Poly1305State->poly1305S[i] = loadLittleEndianUint32(&poly1305Key[POLY1305_BLOCK_SIZE + i * sizeof(uint32_t)]);
+				}
 			}
 
 			// Finally
@@ -167,11 +251,8 @@ void initializeChaCha20Poly1305(volatile ChaCha20Poly1305State *chaCha20Poly1305
 		// End try
 		END_TRY;
 
-		// Convert Poly1305 s to big endian
-		swapEndianness((uint8_t *)&chaCha20Poly1305State->poly1305S, sizeof(chaCha20Poly1305State->poly1305S));
-
 		// Set Poly1305 accumulator to zero
-		explicit_bzero((uint8_t *)chaCha20Poly1305State->poly1305Accumulator, sizeof(chaCha20Poly1305State->poly1305Accumulator));
+		explicit_bzero((uint32_t *)chaCha20Poly1305State->poly1305Accumulator, sizeof(chaCha20Poly1305State->poly1305Accumulator));
 
 		// Update Poly1305 accumulator with the additional authenticated data
 		updatePoly1305Accumulator((ChaCha20Poly1305State *)chaCha20Poly1305State, additionalAuthenticatedData, additionalAuthenticatedDataLength);
@@ -180,8 +261,8 @@ void initializeChaCha20Poly1305(volatile ChaCha20Poly1305State *chaCha20Poly1305
 	// Otherwise
 	else {
 
-		// Initialize resulting ChaCha20 current state with the ChaCha20 Poly1305 state
-		initializeChaCha20CurrentState((ChaCha20Poly1305State *)chaCha20Poly1305State, chaCha20ResultingState);
+		// Initialize resulting ChaCha20 current state with the ChaCha20 Poly1305 state's block
+		getChaCha20Blocks((uint32_t *)chaCha20Poly1305State->chaCha20OriginalState, chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX], chaCha20ResultingState, 1);
 	}
 #endif
 }
@@ -189,6 +270,9 @@ void initializeChaCha20Poly1305(volatile ChaCha20Poly1305State *chaCha20Poly1305
 // Encrypt ChaCha20 Poly1305 data
 void encryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, volatile uint8_t *encryptedDataBlock, const uint8_t *dataBlock, const size_t dataBlockLength) {
 
+	// Start ChaCha20 Poly1305 performance counter with cleanup
+	START_PERFORMANCE_COUNTER_WITH_CLEANUP(CHACHA20_POLY1305_PERFORMANCE_STAGE, ENCRYPT_CHACHA20_POLY1305_PERFORMANCE_OPERATION);
+
 // Check if using SDK's version of ChaCha20 Poly1305
 #ifdef HAVE_CHACHA_POLY
 
@@ -206,46 +290,18 @@ void encryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, v
 // Otherwise
 #else
 
+	// Get number of blocks in the data block
+	const size_t numberOfBlocks = dataBlockLength / CHACHA20_BLOCK_SIZE + ((dataBlockLength % CHACHA20_BLOCK_SIZE) ? 1 : 0);
+
 	// Check if data length or block counter will overflow
-	if(UINT64_MAX - chaCha20Poly1305State->dataLength < dataBlockLength || chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] == UINT32_MAX) {
+	if(UINT64_MAX - chaCha20Poly1305State->dataLength < dataBlockLength || UINT32_MAX - chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] < numberOfBlocks) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
-	// Increment the ChaCha20 original state's block counter
-	++chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX];
-
-	// Initialize ChaCha20 current state
-	volatile uint32_t chaCha20CurrentState[CHACHA20_STATE_SIZE];
-
-	// Begin try
-	BEGIN_TRY {
-
-		// Try
-		TRY {
-
-			// Initialize ChaCha20 current state with the ChaCha20 Poly1305 state
-			initializeChaCha20CurrentState(chaCha20Poly1305State, (uint32_t *)chaCha20CurrentState);
-
-			// Go through all bytes in the data block
-			for(size_t i = 0; i < dataBlockLength; ++i) {
-
-				// Encrypt the byte with the ChaCha20 current state
-				encryptedDataBlock[i] = dataBlock[i] ^ ((uint8_t *)chaCha20CurrentState)[i];
-			}
-		}
-
-		// Finally
-		FINALLY {
-
-			// Clear the ChaCha20 current state
-			explicit_bzero((uint32_t *)chaCha20CurrentState, sizeof(chaCha20CurrentState));
-		}
-	}
-
-	// End try
-	END_TRY;
+	// Encrypt the data block with the ChaCha20 keystream
+	applyChaCha20Keystream(chaCha20Poly1305State, encryptedDataBlock, dataBlock, dataBlockLength);
 
 	// Update Poly1305 accumulator with the encrypted data block
 	updatePoly1305Accumulator(chaCha20Poly1305State, (uint8_t *)encryptedDataBlock, dataBlockLength);
@@ -253,11 +309,17 @@ void encryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, v
 	// Update the data length
 	chaCha20Poly1305State->dataLength += dataBlockLength;
 #endif
+
+	// Stop ChaCha20 Poly1305 performance counter with cleanup
+	STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(CHACHA20_POLY1305_PERFORMANCE_STAGE);
 }
 
 // Decrypt ChaCha20 Poly1305 data
 void decryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, volatile uint8_t *decryptedDataBlock, const uint8_t *dataBlock, const size_t dataBlockLength) {
 
+	// Start ChaCha20 Poly1305 performance counter with cleanup
+	START_PERFORMANCE_COUNTER_WITH_CLEANUP(CHACHA20_POLY1305_PERFORMANCE_STAGE, DECRYPT_CHACHA20_POLY1305_PERFORMANCE_OPERATION);
+
 // Check if using SDK's version of ChaCha20 Poly1305
 #ifdef HAVE_CHACHA_POLY
 
@@ -275,46 +337,18 @@ void decryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, v
 // Otherwise
 #else
 
+	// Get number of blocks in the data block
+	const size_t numberOfBlocks = dataBlockLength / CHACHA20_BLOCK_SIZE + ((dataBlockLength % CHACHA20_BLOCK_SIZE) ? 1 : 0);
+
 	// Check if data length or block counter will overflow
-	if(UINT64_MAX - chaCha20Poly1305State->dataLength < dataBlockLength || chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] == UINT32_MAX) {
+	if(UINT64_MAX - chaCha20Poly1305State->dataLength < dataBlockLength || UINT32_MAX - chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] < numberOfBlocks) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
-	// Increment the ChaCha20 original state's block counter
-	++chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX];
-
-	// Initialize ChaCha20 current state
-	volatile uint32_t chaCha20CurrentState[CHACHA20_STATE_SIZE];
-
-	// Begin try
-	BEGIN_TRY {
-
-		// Try
-		TRY {
-
-			// Initialize ChaCha20 current state with the ChaCha20 Poly1305 state
-			initializeChaCha20CurrentState(chaCha20Poly1305State, (uint32_t *)chaCha20CurrentState);
-
-			// Go through all bytes in the data block
-			for(size_t i = 0; i < dataBlockLength; ++i) {
-
-				// Decrypt the byte with the ChaCha20 current state
-				decryptedDataBlock[i] = dataBlock[i] ^ ((uint8_t *)chaCha20CurrentState)[i];
-			}
-		}
-
-		// Finally
-		FINALLY {
-
-			// Clear the ChaCha20 current state
-			explicit_bzero((uint32_t *)chaCha20CurrentState, sizeof(chaCha20CurrentState));
-		}
-	}
-
-	// End try
-	END_TRY;
+	// Decrypt the data block with the ChaCha20 keystream
+	applyChaCha20Keystream(chaCha20Poly1305State, decryptedDataBlock, dataBlock, dataBlockLength);
 
 	// Update Poly1305 accumulator with the data block
 	updatePoly1305Accumulator(chaCha20Poly1305State, dataBlock, dataBlockLength);
@@ -322,6 +356,9 @@ void decryptChaCha20Poly1305Data(ChaCha20Poly1305State *chaCha20Poly1305State, v
 	// Update the data length
 	chaCha20Poly1305State->dataLength += dataBlockLength;
 #endif
+
+	// Stop ChaCha20 Poly1305 performance counter with cleanup
+	STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(CHACHA20_POLY1305_PERFORMANCE_STAGE);
 }
 
 // Get ChaCha20 Poly1305 tag
@@ -356,14 +393,8 @@ void getChaCha20Poly1305Tag(const ChaCha20Poly1305State *chaCha20Poly1305State,
 			// Update Poly1305 accumulator with the lengths
 			updatePoly1305Accumulator((ChaCha20Poly1305State *)&copy, lengths, sizeof(lengths));
 
-			// Add Poly1305 s to the Poly1305 accumulator
-			cx_math_add((uint8_t *)copy.poly1305Accumulator, (uint8_t *)copy.poly1305Accumulator, (uint8_t *)copy.poly1305S, sizeof(copy.poly1305Accumulator));
-
-			// Convert the Poly1305 accumulator to little endian
-			swapEndianness((uint8_t *)copy.poly1305Accumulator, sizeof(copy.poly1305Accumulator));
-
-			// Set tag to the Poly1305 accumulator
-			memcpy((uint8_t *)tag, (uint8_t *)copy.poly1305Accumulator, POLY1305_TAG_SIZE);
+			// Set tag to the finished Poly1305 accumulator
+			finishPoly1305Accumulator((ChaCha20Poly1305State *)&copy, (uint8_t *)tag);
 #endif
 		}
 
@@ -382,91 +413,314 @@ void getChaCha20Poly1305Tag(const ChaCha20Poly1305State *chaCha20Poly1305State,
 // Check if not using SDK's version of ChaCha20 Poly1305
 #ifndef HAVE_CHACHA_POLY
 
-// Quarter round
-void quarterRound(uint32_t *a, uint32_t *b, uint32_t *c, uint32_t *d) {
+// Get ChaCha20 blocks
+void getChaCha20Blocks(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Blocks, const size_t numberOfBlocks) {
 
-	// Perform quarter round
-	*a += *b;
-	*d ^= *a;
-	rotateLeft(d, 16);
+	// Initialize index
+	size_t i = 0;
 
-	*c += *d;
-	*b ^= *c;
-	rotateLeft(b, 12);
+// Check if computing multiple ChaCha20 blocks in parallel
+#if CHACHA20_NUMBER_OF_PARALLEL_BLOCKS > 1
 
-	*a += *b;
-	*d ^= *a;
-	rotateLeft(d, 8);
+	// Go through all groups of parallel blocks
+	for(; numberOfBlocks - i >= CHACHA20_NUMBER_OF_PARALLEL_BLOCKS; i += CHACHA20_NUMBER_OF_PARALLEL_BLOCKS) {
 
-	*c += *d;
-	*b ^= *c;
-	rotateLeft(b, 7);
-}
+		// Get parallel blocks
+		getParallelChaCha20Blocks(chaCha20OriginalState, blockCounter + i, &chaCha20Blocks[i * CHACHA20_STATE_SIZE]);
+	}
+#endif
 
-// Rotate left
-void rotateLeft(uint32_t *value, const size_t bits) {
+	// Go through all remaining blocks
+	for(; i < numberOfBlocks; ++i) {
 
-	// Rotate value left by number of bits
-	*value = (*value << bits) | (*value >> (sizeof(*value) * BITS_IN_A_BYTE - bits));
+		// Get block
+		getChaCha20Block(chaCha20OriginalState, blockCounter + i, &chaCha20Blocks[i * CHACHA20_STATE_SIZE]);
+	}
 }
 
-// Initialize ChaCha20 current state
-void initializeChaCha20CurrentState(const ChaCha20Poly1305State *chaCha20Poly1305State, uint32_t *chaCha20CurrentState) {
+// Get ChaCha20 block
+void getChaCha20Block(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Block) {
 
-	// Set ChaCha20 current state as the ChaCha20 original state
-	memcpy(chaCha20CurrentState, chaCha20Poly1305State->chaCha20OriginalState, sizeof(chaCha20Poly1305State->chaCha20OriginalState));
+	// Set ChaCha20 block as the ChaCha20 original state with the block counter
+	uint32_t state[CHACHA20_STATE_SIZE];
+	memcpy(state, chaCha20OriginalState, sizeof(state));
+	state[CHACHA20_STATE_BLOCK_COUNTER_INDEX] = blockCounter;
 
-	// Go through ten iterations
-	for(uint_fast8_t i = 0; i < 10; ++i) {
+	// Go through all double rounds
+	for(uint_fast8_t i = 0; i < CHACHA20_NUMBER_OF_DOUBLE_ROUNDS; ++i) {
 
-		// Perform two rounds on the ChaCha20 current state
-		quarterRound(&chaCha20CurrentState[0], &chaCha20CurrentState[4], &chaCha20CurrentState[8], &chaCha20CurrentState[12]);
-		quarterRound(&chaCha20CurrentState[1], &chaCha20CurrentState[5], &chaCha20CurrentState[9], &chaCha20CurrentState[13]);
-		quarterRound(&chaCha20CurrentState[2], &chaCha20CurrentState[6], &chaCha20CurrentState[10], &chaCha20CurrentState[14]);
-		quarterRound(&chaCha20CurrentState[3], &chaCha20CurrentState[7], &chaCha20CurrentState[11], &chaCha20CurrentState[15]);
-		quarterRound(&chaCha20CurrentState[0], &chaCha20CurrentState[5], &chaCha20CurrentState[10], &chaCha20CurrentState[15]);
-		quarterRound(&chaCha20CurrentState[1], &chaCha20CurrentState[6], &chaCha20CurrentState[11], &chaCha20CurrentState[12]);
-		quarterRound(&chaCha20CurrentState[2], &chaCha20CurrentState[7], &chaCha20CurrentState[8], &chaCha20CurrentState[13]);
-		quarterRound(&chaCha20CurrentState[3], &chaCha20CurrentState[4], &chaCha20CurrentState[9], &chaCha20CurrentState[14]);
+		// Perform double round on the state
+		CHACHA20_DOUBLE_ROUND(state);
 	}
 
-	// Go through all parts of the ChaCha20 current state
+	// Go through all parts of the state
 	for(size_t i = 0; i < CHACHA20_STATE_SIZE; ++i) {
 
-		// Add ChaCha20 original state part to the ChaCha20 current state part
-		chaCha20CurrentState[i] += chaCha20Poly1305State->chaCha20OriginalState[i];
+		// Set ChaCha20 block part to the state part added to the ChaCha20 original state part
+		chaCha20Block[i] = state[i] + ((i == CHACHA20_STATE_BLOCK_COUNTER_INDEX) ? blockCounter : chaCha20OriginalState[i]);
 	}
+
+	// Clear the state
+	explicit_bzero(state, sizeof(state));
 }
 
-// Update Poly1305 accumulator
-void updatePoly1305Accumulator(ChaCha20Poly1305State *chaCha20Poly1305State, const uint8_t *value, const size_t valueLength) {
+// Check if computing multiple ChaCha20 blocks in parallel
+#if CHACHA20_NUMBER_OF_PARALLEL_BLOCKS > 1
+
+	// Get parallel ChaCha20 blocks
+	void getParallelChaCha20Blocks(const uint32_t *chaCha20OriginalState, const uint32_t blockCounter, uint32_t *chaCha20Blocks) {
+
+		// Set each state part's lanes to the ChaCha20 original state part
+		ChaCha20Vector initialState[CHACHA20_STATE_SIZE];
+		for(size_t i = 0; i < CHACHA20_STATE_SIZE; ++i) {
 
-	// Go through all blocks in the value
-	for(size_t i = 0; i <= valueLength / POLY1305_BLOCK_SIZE; ++i) {
+			// Set state part's lanes to the ChaCha20 original state part
+			initialState[i] = (ChaCha20Vector){0} + chaCha20OriginalState[i];
+		}
+
+		// Set each lane's block counter to the block counter offset by its lane
+		initialState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] = CHACHA20_LANE_BLOCK_COUNTER_OFFSETS + blockCounter;
 
-		// Get current block size
-		const size_t currentBlockSize = MIN(MAX((int8_t)valueLength - POLY1305_BLOCK_SIZE * i, 0), POLY1305_BLOCK_SIZE);
+		// Set state to the initial state
+		ChaCha20Vector state[CHACHA20_STATE_SIZE];
+		memcpy(state, initialState, sizeof(state));
 
-		// Check if the current block isn't empty
-		if(currentBlockSize) {
+		// Go through all double rounds
+		for(uint_fast8_t i = 0; i < CHACHA20_NUMBER_OF_DOUBLE_ROUNDS; ++i) {
 
-			// Copy current block to block and set the highest byte to one
-			uint8_t block[POLY1305_NUMBER_SIZE] = {
-				[POLY1305_NUMBER_SIZE - 1] = 1,
-			};
+			// Perform double round on all lanes of the state
+			CHACHA20_DOUBLE_ROUND(state);
+		}
 
-			memcpy(block, &value[i * POLY1305_BLOCK_SIZE], currentBlockSize);
+		// Go through all parts of the state
+		for(size_t i = 0; i < CHACHA20_STATE_SIZE; ++i) {
 
-			// Convert block to big endian
-			swapEndianness(block, sizeof(block));
+			// Add initial state part to the state part
+			state[i] += initialState[i];
 
-			// Add block to the Poly1305 accumulator
-			cx_math_add(chaCha20Poly1305State->poly1305Accumulator, chaCha20Poly1305State->poly1305Accumulator, block, sizeof(chaCha20Poly1305State->poly1305Accumulator));
+			// Go through all lanes
+			for(size_t j = 0; j < CHACHA20_NUMBER_OF_PARALLEL_BLOCKS; ++j) {
 
-			// Multiply the Poly1305 accumulator by the Poly1305 r and modulo it by the Poly1305 p and throw error if it fails
-			CX_THROW(cx_math_multm_no_throw(chaCha20Poly1305State->poly1305Accumulator, chaCha20Poly1305State->poly1305Accumulator, chaCha20Poly1305State->poly1305R, POLY1305_P, sizeof(chaCha20Poly1305State->poly1305Accumulator)));
+				// Set lane's ChaCha20 block part to the state part's lane
+				chaCha20Blocks[j * CHACHA20_STATE_SIZE + i] = state[i][j];
+			}
 		}
+
+		// Clear the state
+		explicit_bzero(state, sizeof(state));
 	}
+#endif
+
+// Apply ChaCha20 keystream
+void applyChaCha20Keystream(ChaCha20Poly1305State *chaCha20Poly1305State, volatile uint8_t *result, const uint8_t *data, const size_t dataLength) {
+
+	// Initialize keystream
+	volatile uint32_t keystream[CHACHA20_STATE_SIZE * CHACHA20_NUMBER_OF_PARALLEL_BLOCKS];
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Go through all chunks in the data
+			for(size_t i = 0; i < dataLength; i += sizeof(keystream)) {
+
+				// Get chunk length and its number of blocks
+				const size_t chunkLength = MIN(dataLength - i, sizeof(keystream));
+				const size_t numberOfBlocks = chunkLength / CHACHA20_BLOCK_SIZE + ((chunkLength % CHACHA20_BLOCK_SIZE) ? 1 : 0);
+
+				// Get keystream for the blocks after the ChaCha20 original state's block counter
+				getChaCha20Blocks(chaCha20Poly1305State->chaCha20OriginalState, chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] + 1, (uint32_t *)keystream, numberOfBlocks);
+
+				// Advance the ChaCha20 original state's block counter past the blocks
+				chaCha20Poly1305State->chaCha20OriginalState[CHACHA20_STATE_BLOCK_COUNTER_INDEX] += numberOfBlocks;
+
+				// Go through all bytes in the chunk
+				for(size_t j = 0; j < chunkLength; ++j) {
+
+					// Set result byte to the data byte combined with the keystream
+					result[i + j] = data[i + j] ^ ((uint8_t *)keystream)[j];
+				}
+			}
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the keystream
+			explicit_bzero((uint32_t *)keystream, sizeof(keystream));
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Update Poly1305 accumulator
+void updatePoly1305Accumulator(ChaCha20Poly1305State *chaCha20Poly1305State, const uint8_t *value, const size_t valueLength) {
+
+	// Go through all full blocks in the value
+	size_t i = 0;
+	for(; valueLength - i >= POLY1305_BLOCK_SIZE; i += POLY1305_BLOCK_SIZE) {
+
+		// Process block
+		processPoly1305Block(chaCha20Poly1305State, &value[i]);
+	}
+
+	// Check if a partial block remains
+	if(i != valueLength) {
+
+		// Copy partial block to block padded with zeros
+		uint8_t block[POLY1305_BLOCK_SIZE] = {0};
+		memcpy(block, &value[i], valueLength - i);
+
+		// Process block
+		processPoly1305Block(chaCha20Poly1305State, block);
+	}
+}
+
+// Process Poly1305 block
+void processPoly1305Block(ChaCha20Poly1305State *chaCha20Poly1305State, const uint8_t *block) {
+
+	// Get Poly1305 r
+	const uint32_t r0 = chaCha20Poly1305State->poly1305R[0];
+	const uint32_t r1 = chaCha20Poly1305State->poly1305R[1];
+	const uint32_t r2 = chaCha20Poly1305State->poly1305R[2];
+	const uint32_t r3 = chaCha20Poly1305State->poly1305R[3];
+	const uint32_t r4 = chaCha20Poly1305State->poly1305R[4];
+
+	// Get Poly1305 r multiplied by five which folds the products above 2^130 back into the lower limbs
+	const uint32_t s1 = r1 * 5;
+	const uint32_t s2 = r2 * 5;
+	const uint32_t s3 = r3 * 5;
+	const uint32_t s4 = r4 * 5;
+
+	// Add block with its high bit set to the Poly1305 accumulator
+	uint32_t h0 = chaCha20Poly1305State->poly1305Accumulator[0] + (loadLittleEndianUint32(&block[0]) & POLY1305_LIMB_MASK);
+	uint32_t h1 = chaCha20Poly1305State->poly1305Accumulator[1] + ((loadLittleEndianUint32(&block[3]) >> 2) & POLY1305_LIMB_MASK);
+	uint32_t h2 = chaCha20Poly1305State->poly1305Accumulator[2] + ((loadLittleEndianUint32(&block[6]) >> 4) & POLY1305_LIMB_MASK);
+	uint32_t h3 = chaCha20Poly1305State->poly1305Accumulator[3] + ((loadLittleEndianUint32(&block[9]) >> 6) & POLY1305_LIMB_MASK);
+	uint32_t h4 = chaCha20Poly1305State->poly1305Accumulator[4] + ((loadLittleEndianUint32(&block[12]) >> 8) | POLY1305_BLOCK_HIGH_BIT);
+
+	// Multiply the Poly1305 accumulator by the Poly1305 r
+	const uint64_t d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3 + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+	uint64_t d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4 + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+	uint64_t d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0 + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+	uint64_t d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1 + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+	uint64_t d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2 + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+	// Partially reduce the product modulo 2^130 - 5
+	uint32_t carry = (uint32_t)(d0 >> POLY1305_LIMB_SIZE);
+	h0 = (uint32_t)d0 & POLY1305_LIMB_MASK;
+	d1 += carry;
+	carry = (uint32_t)(d1 >> POLY1305_LIMB_SIZE);
+	h1 = (uint32_t)d1 & POLY1305_LIMB_MASK;
+	d2 += carry;
+	carry = (uint32_t)(d2 >> POLY1305_LIMB_SIZE);
+	h2 = (uint32_t)d2 & POLY1305_LIMB_MASK;
+	d3 += carry;
+	carry = (uint32_t)(d3 >> POLY1305_LIMB_SIZE);
+	h3 = (uint32_t)d3 & POLY1305_LIMB_MASK;
+	d4 += carry;
+	carry = (uint32_t)(d4 >> POLY1305_LIMB_SIZE);
+	h4 = (uint32_t)d4 & POLY1305_LIMB_MASK;
+	h0 += carry * 5;
+	carry = h0 >> POLY1305_LIMB_SIZE;
+	h0 &= POLY1305_LIMB_MASK;
+	h1 += carry;
+
+	// Set the Poly1305 accumulator to the result
+	chaCha20Poly1305State->poly1305Accumulator[0] = h0;
+	chaCha20Poly1305State->poly1305Accumulator[1] = h1;
+	chaCha20Poly1305State->poly1305Accumulator[2] = h2;
+	chaCha20Poly1305State->poly1305Accumulator[3] = h3;
+	chaCha20Poly1305State->poly1305Accumulator[4] = h4;
+}
+
+// Finish Poly1305 accumulator
+void finishPoly1305Accumulator(ChaCha20Poly1305State *chaCha20Poly1305State, uint8_t *tag) {
+
+	// Get the Poly1305 accumulator
+	uint32_t h0 = chaCha20Poly1305State->poly1305Accumulator[0];
+	uint32_t h1 = chaCha20Poly1305State->poly1305Accumulator[1];
+	uint32_t h2 = chaCha20Poly1305State->poly1305Accumulator[2];
+	uint32_t h3 = chaCha20Poly1305State->poly1305Accumulator[3];
+	uint32_t h4 = chaCha20Poly1305State->poly1305Accumulator[4];
+
+	// Fully carry the Poly1305 accumulator
+	uint32_t carry = h1 >> POLY1305_LIMB_SIZE;
+	h1 &= POLY1305_LIMB_MASK;
+	h2 += carry;
+	carry = h2 >> POLY1305_LIMB_SIZE;
+	h2 &= POLY1305_LIMB_MASK;
+	h3 += carry;
+	carry = h3 >> POLY1305_LIMB_SIZE;
+	h3 &= POLY1305_LIMB_MASK;
+	h4 += carry;
+	carry = h4 >> POLY1305_LIMB_SIZE;
+	h4 &= POLY1305_LIMB_MASK;
+	h0 += carry * 5;
+	carry = h0 >> POLY1305_LIMB_SIZE;
+	h0 &= POLY1305_LIMB_MASK;
+	h1 += carry;
+
+	// Get the Poly1305 accumulator minus 2^130 - 5
+	uint32_t g0 = h0 + 5;
+	carry = g0 >> POLY1305_LIMB_SIZE;
+	g0 &= POLY1305_LIMB_MASK;
+	uint32_t g1 = h1 + carry;
+	carry = g1 >> POLY1305_LIMB_SIZE;
+	g1 &= POLY1305_LIMB_MASK;
+	uint32_t g2 = h2 + carry;
+	carry = g2 >> POLY1305_LIMB_SIZE;
+	g2 &= POLY1305_LIMB_MASK;
+	uint32_t g3 = h3 + carry;
+	carry = g3 >> POLY1305_LIMB_SIZE;
+	g3 &= POLY1305_LIMB_MASK;
+	const uint32_t g4 = h4 + carry - (UINT32_C(1) << POLY1305_LIMB_SIZE);
+
+	// Select the reduced Poly1305 accumulator without branching
+	const uint32_t mask = (g4 >> (sizeof(g4) * BITS_IN_A_BYTE - 1)) - 1;
+	h0 = (h0 & ~mask) | (g0 & mask);
+	h1 = (h1 & ~mask) | (g1 & mask);
+	h2 = (h2 & ~mask) | (g2 & mask);
+	h3 = (h3 & ~mask) | (g3 & mask);
+	h4 = (h4 & ~mask) | (g4 & mask);
+
+	// Pack the Poly1305 accumulator into 32-bit words
+	const uint32_t words[] = {
+		h0 | (h1 << 26),
+		(h1 >> 6) | (h2 << 20),
+		(h2 >> 12) | (h3 << 14),
+		(h3 >> 18) | (h4 << 8)
+	};
+
+	// Go through all words
+	uint64_t sum = 0;
+	for(size_t i = 0; i < POLY1305_KEY_PART_NUMBER_OF_WORDS; ++i) {
+
+		// Add Poly1305 s to the word and set the tag part to the result
+		sum = (uint64_t)words[i] + chaCha20Poly1305State->poly1305S[i] + (sum >> (sizeof(uint32_t) * BITS_IN_A_BYTE));
+		storeLittleEndianUint32(&tag[i * sizeof(uint32_t)], (uint32_t)sum);
+	}
+}
+
+// Load little endian uint32
+uint32_t loadLittleEndianUint32(const uint8_t *value) {
+
+	// Return value as a little endian uint32
+	return (uint32_t)value[0] | ((uint32_t)value[1] << 8) | ((uint32_t)value[2] << 16) | ((uint32_t)value[3] << 24);
+}
+
+// Store little endian uint32
+void storeLittleEndianUint32(uint8_t *result, const uint32_t value) {
+
+	// Set result to value as a little endian uint32
+	result[0] = value;
+	result[1] = value >> 8;
+	result[2] = value >> 16;
+	result[3] = value >> 24;
 }
 
 #endif
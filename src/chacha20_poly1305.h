@@ -14,8 +14,11 @@
 // ChaCha20 block size
 #define CHACHA20_BLOCK_SIZE 64
 
-// Poly1305 number size
-#define POLY1305_NUMBER_SIZE 17
+// Poly1305 number number of limbs
+#define POLY1305_NUMBER_NUMBER_OF_LIMBS 5
+
+// Poly1305 key part number of words
+#define POLY1305_KEY_PART_NUMBER_OF_WORDS 4
 
 // ChaCha20 nonce size
 #define CHACHA20_NONCE_SIZE 12
@@ -44,14 +47,14 @@ typedef struct {
 	// ChaCha20 original state
 	uint32_t chaCha20OriginalState[CHACHA20_STATE_SIZE];
 
-	// Poly1305 r
-	uint8_t poly1305R[POLY1305_NUMBER_SIZE];
+	// Poly1305 r in 26-bit limbs
+	uint32_t poly1305R[POLY1305_NUMBER_NUMBER_OF_LIMBS];
 
 	// Poly1305 s
-	uint8_t poly1305S[POLY1305_NUMBER_SIZE];
+	uint32_t poly1305S[POLY1305_KEY_PART_NUMBER_OF_WORDS];
 
-	// Poly1305 accumulator
-	uint8_t poly1305Accumulator[POLY1305_NUMBER_SIZE];
+	// Poly1305 accumulator in 26-bit limbs
+	uint32_t poly1305Accumulator[POLY1305_NUMBER_NUMBER_OF_LIMBS];
 
 	// Additional authenticated data length
 	uint64_t additionalAuthenticatedDataLength;
@@ -20,20 +20,32 @@ void processContinueDecryptingSlateRequest(unsigned short *responseLength, __att
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
+
+	// Get chunk type from first parameter
+	const enum SlateChunkType chunkType = firstParameter;
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || !dataLength || dataLength > CHACHA20_BLOCK_SIZE) {
+	if((chunkType != MORE_SLATE_CHUNK_TYPE && chunkType != LAST_SLATE_CHUNK_TYPE) || !dataLength || dataLength > SLATE_MAXIMUM_CHUNK_SIZE) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
+	// Check if chunk is the last chunk
+	const bool isLastChunk = chunkType == LAST_SLATE_CHUNK_TYPE || dataLength % CHACHA20_BLOCK_SIZE;
+
+	// Get slate session with the handle
+	struct SlateSession *session = getSlateSession(handle);
+
 	// Check if slate decrypting state isn't ready or active
-	if(slate.decryptingState != READY_SLATE_STATE && slate.decryptingState != ACTIVE_SLATE_STATE) {
+	if(session->decryptingState != READY_SLATE_STATE && session->decryptingState != ACTIVE_SLATE_STATE) {
 
 		// Throw invalid state error
 		THROW(INVALID_STATE_ERROR);
@@ -43,7 +55,7 @@ void processContinueDecryptingSlateRequest(unsigned short *responseLength, __att
 	volatile uint8_t *decryptedData = alloca(dataLength);
 
 	// Get encrypted data length
-	const size_t encryptedDataLength = getEncryptedDataLength(dataLength);
+	const size_t encryptedDataLength = (session->sessionCipherVersion == STREAMING_SLATE_SESSION_CIPHER_VERSION) ? getSessionCipherEncryptedDataLength(dataLength, isLastChunk) : getEncryptedDataLength(dataLength);
 
 	// Initialize encrypted data
 	volatile uint8_t *encryptedData = alloca(encryptedDataLength);
@@ -55,10 +67,21 @@ void processContinueDecryptingSlateRequest(unsigned short *responseLength, __att
 		TRY {
 
 			// Decrypt ChaCha20 Poly1305 data
-			decryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&slate.chaCha20Poly1305State, decryptedData, data, dataLength);
+			decryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&session->chaCha20Poly1305State, decryptedData, data, dataLength);
+
+			// Check if session cipher version is streaming
+			if(session->sessionCipherVersion == STREAMING_SLATE_SESSION_CIPHER_VERSION) {
+
+				// Encrypt the decrypted data with the slate's session cipher
+				encryptSessionCipherData(&session->sessionCipher, encryptedData, (uint8_t *)decryptedData, dataLength, isLastChunk);
+			}
+
+			// Otherwise
+			else {
 
-			// Encrypt the decrypted data
-			encryptData(encryptedData, (uint8_t *)decryptedData, dataLength, slate.sessionKey, sizeof(slate.sessionKey));
+				// Encrypt the decrypted data
+				encryptData(encryptedData, (uint8_t *)decryptedData, dataLength, session->sessionKey, sizeof(session->sessionKey));
+			}
 		}
 
 		// Finally
@@ -80,22 +103,22 @@ void processContinueDecryptingSlateRequest(unsigned short *responseLength, __att
 	}
 
 	// Append encrypted data to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)encryptedData, encryptedDataLength);
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)encryptedData, encryptedDataLength);
 
 	*responseLength += encryptedDataLength;
 
-	// Check if at the last data
-	if(dataLength < CHACHA20_BLOCK_SIZE) {
+	// Check if at the last chunk
+	if(isLastChunk) {
 
 		// Set that slate decrypting state is complete
-		slate.decryptingState = COMPLETE_SLATE_STATE;
+		session->decryptingState = COMPLETE_SLATE_STATE;
 	}
 
 	// Otherwise
 	else {
 
 		// Set that slate decrypting state is active
-		slate.decryptingState = ACTIVE_SLATE_STATE;
+		session->decryptingState = ACTIVE_SLATE_STATE;
 	}
 
 	// Throw success
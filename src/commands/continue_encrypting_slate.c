@@ -19,20 +19,32 @@ void processContinueEncryptingSlateRequest(unsigned short *responseLength, __att
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
+
+	// Get chunk type from first parameter
+	const enum SlateChunkType chunkType = firstParameter;
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || !dataLength || dataLength > CHACHA20_BLOCK_SIZE) {
+	if((chunkType != MORE_SLATE_CHUNK_TYPE && chunkType != LAST_SLATE_CHUNK_TYPE) || !dataLength || dataLength > SLATE_MAXIMUM_CHUNK_SIZE) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
+	// Check if chunk is the last chunk
+	const bool isLastChunk = chunkType == LAST_SLATE_CHUNK_TYPE || dataLength % CHACHA20_BLOCK_SIZE;
+
+	// Get slate session with the handle
+	struct SlateSession *session = getSlateSession(handle);
+
 	// Check if slate encrypting state isn't ready or active
-	if(slate.encryptingState != READY_SLATE_STATE && slate.encryptingState != ACTIVE_SLATE_STATE) {
+	if(session->encryptingState != READY_SLATE_STATE && session->encryptingState != ACTIVE_SLATE_STATE) {
 
 		// Throw invalid state error
 		THROW(INVALID_STATE_ERROR);
@@ -42,18 +54,13 @@ void processContinueEncryptingSlateRequest(unsigned short *responseLength, __att
 	uint8_t *encryptedData = alloca(dataLength);
 
 	// Encrypt ChaCha20 Poly1305 data
-	encryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&slate.chaCha20Poly1305State, encryptedData, data, dataLength);
+	encryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&session->chaCha20Poly1305State, encryptedData, data, dataLength);
 
 	// Check if creating message hash
-	if(slate.messageHashState.header.info) {
-
-		// Get encrypted data as a string
-		const size_t encryptedDataStringLength = dataLength * HEXADECIMAL_CHARACTER_SIZE;
-		char *encryptedDataString = alloca(encryptedDataStringLength);
-		toHexString(encryptedDataString, encryptedData, dataLength);
+	if(session->messageHashState.header.info) {
 
-		// Add encrypted data string to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)encryptedDataString, encryptedDataStringLength, NULL, 0));
+		// Add encrypted data as a string to the message hash state
+		addHexStringToHash((cx_hash_t *)&session->messageHashState, encryptedData, dataLength);
 	}
 
 	// Check if response with the encrypted data will overflow
@@ -64,22 +71,22 @@ void processContinueEncryptingSlateRequest(unsigned short *responseLength, __att
 	}
 
 	// Append encrypted data to response
-	memcpy(&G_io_apdu_buffer[*responseLength], encryptedData, dataLength);
+	memcpy(&getResponseBuffer()[*responseLength], encryptedData, dataLength);
 
 	*responseLength += dataLength;
 
-	// Check if at the last data
-	if(dataLength < CHACHA20_BLOCK_SIZE) {
+	// Check if at the last chunk
+	if(isLastChunk) {
 
 		// Set thatslate encrypting state is complete
-		slate.encryptingState = COMPLETE_SLATE_STATE;
+		session->encryptingState = COMPLETE_SLATE_STATE;
 	}
 
 	// Otherwise
 	else {
 
 		// Set that slate encrypting state is active
-		slate.encryptingState = ACTIVE_SLATE_STATE;
+		session->encryptingState = ACTIVE_SLATE_STATE;
 	}
 
 	// Throw success
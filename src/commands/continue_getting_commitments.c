@@ -0,0 +1,132 @@
+// Header files
+#include <string.h>
+#include "../common.h"
+#include "../commitments.h"
+#include "continue_getting_commitments.h"
+#include "../crypto.h"
+
+
+// Definitions
+
+// Commitment request size
+#define COMMITMENT_REQUEST_SIZE (sizeof(uint32_t) + sizeof(uint64_t))
+
+// Maximum number of commitments per request
+#define MAXIMUM_NUMBER_OF_COMMITMENTS_PER_REQUEST 16
+
+
+// Supporting function implementation
+
+// Process continue getting commitments request
+void processContinueGettingCommitmentsRequest(unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
+
+	// Get request's first parameter
+	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's second parameter
+	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+	// Get request's data length
+	const size_t dataLength = getRequestDataLength();
+
+	// Get request's data
+	const uint8_t *data = getRequestData();
+
+	// Check if parameters or data are invalid
+	if(firstParameter || secondParameter || !dataLength || dataLength % COMMITMENT_REQUEST_SIZE || dataLength / COMMITMENT_REQUEST_SIZE > MAXIMUM_NUMBER_OF_COMMITMENTS_PER_REQUEST) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Check if commitments hasn't started
+	if(!commitments.started) {
+
+		// Throw invalid state error
+		THROW(INVALID_STATE_ERROR);
+	}
+
+	// Get number of commitments
+	const size_t numberOfCommitments = dataLength / COMMITMENT_REQUEST_SIZE;
+
+	// Check if response with the commitments will overflow
+	if(willResponseOverflow(*responseLength, numberOfCommitments * COMMITMENT_SIZE)) {
+
+		// Throw length error
+		THROW(ERR_APD_LEN);
+	}
+
+	// Initialize indices and values
+	uint32_t indices[MAXIMUM_NUMBER_OF_COMMITMENTS_PER_REQUEST];
+	uint64_t values[MAXIMUM_NUMBER_OF_COMMITMENTS_PER_REQUEST];
+
+	// Go through all commitment requests in the data since the response will overwrite them
+	for(size_t i = 0; i < numberOfCommitments; ++i) {
+
+		// Get index delta from data
+		uint32_t indexDelta;
+		memcpy(&indexDelta, &data[i * COMMITMENT_REQUEST_SIZE], sizeof(indexDelta));
+
+		// Check if index delta is invalid
+		if(indexDelta > UINT32_MAX - commitments.baseIndex) {
+
+			// Throw invalid parameters error
+			THROW(INVALID_PARAMETERS_ERROR);
+		}
+
+		// Get index from the base index and index delta
+		indices[i] = commitments.baseIndex + indexDelta;
+
+		// Get value from data
+		memcpy(&values[i], &data[i * COMMITMENT_REQUEST_SIZE + sizeof(indexDelta)], sizeof(values[i]));
+
+		// Check if value is invalid
+		if(!values[i]) {
+
+			// Throw invalid parameters error
+			THROW(INVALID_PARAMETERS_ERROR);
+		}
+	}
+
+	// Initialize blinding factor
+	volatile uint8_t blindingFactor[BLINDING_FACTOR_SIZE];
+
+	// Initialize commit
+	volatile uint8_t commitment[COMMITMENT_SIZE];
+
+	// Go through all commitments
+	for(size_t i = 0; i < numberOfCommitments; ++i) {
+
+		// Begin try
+		BEGIN_TRY {
+
+			// Try
+			TRY {
+
+				// Derive blinding factor from the parent key
+				deriveBlindingFactorFromParentKey(blindingFactor, (cx_ecfp_private_key_t *)&commitments.parentPrivateKey, (uint8_t *)commitments.parentChainCode, indices[i], values[i], commitments.switchType);
+
+				// Commit value with the blinding factor
+				commitValue(commitment, values[i], (uint8_t *)blindingFactor, true);
+			}
+
+			// Finally
+			FINALLY {
+
+				// Clear the blinding factor
+				explicit_bzero((uint8_t *)blindingFactor, sizeof(blindingFactor));
+			}
+		}
+
+		// End try
+		END_TRY;
+
+		// Append commitment to response
+		memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)commitment, sizeof(commitment));
+
+		*responseLength += sizeof(commitment);
+	}
+
+	// Throw success
+	THROW(SWO_SUCCESS);
+}
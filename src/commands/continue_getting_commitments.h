@@ -0,0 +1,12 @@
+// Header guard
+#ifndef CONTINUE_GETTING_COMMITMENTS_H
+#define CONTINUE_GETTING_COMMITMENTS_H
+
+
+// Function prototypes
+
+// Process continue getting commitments request
+void processContinueGettingCommitmentsRequest(unsigned short *responseLength, const unsigned char *responseFlags);
+
+
+#endif
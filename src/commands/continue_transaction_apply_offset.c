@@ -18,10 +18,10 @@ void processContinueTransactionApplyOffsetRequest(unsigned short *responseLength
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != BLINDING_FACTOR_SIZE) {
@@ -68,6 +68,9 @@ void processContinueTransactionApplyOffsetRequest(unsigned short *responseLength
 		THROW(INVALID_STATE_ERROR);
 	}
 
+	// Set that transaction's public key isn't cached
+	transaction.publicKeyCached = false;
+
 	// Update transaction's blinding factor with the offset as a negative blinding factor
 	updateBlindingFactorSum((uint8_t *)transaction.blindingFactor, offset, false);
 
@@ -91,7 +94,7 @@ void processContinueTransactionApplyOffsetRequest(unsigned short *responseLength
 			}
 
 			// Append transaction's secret nonce index to response
-			memcpy(&G_io_apdu_buffer[*responseLength], &transaction.secretNonceIndex, sizeof(transaction.secretNonceIndex));
+			memcpy(&getResponseBuffer()[*responseLength], &transaction.secretNonceIndex, sizeof(transaction.secretNonceIndex));
 
 			*responseLength += sizeof(transaction.secretNonceIndex);
 		}
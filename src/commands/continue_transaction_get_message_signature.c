@@ -19,10 +19,10 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || !dataLength) {
@@ -76,9 +76,6 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 	uint8_t hash[SINGLE_SIGNER_MESSAGE_SIZE];
 	getBlake2b(hash, sizeof(hash), (uint8_t *)message, messageLength, NULL, 0);
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
 	// Initialize secret nonce
 	volatile uint8_t secretNonce[NONCE_SIZE];
 
@@ -91,12 +88,8 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 		// Try
 		TRY {
 
-			// Get private key from the transaction's blinding factor and throw error if it fails
-			CX_THROW(cx_ecfp_init_private_key_no_throw(CX_CURVE_SECP256K1, (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor), (cx_ecfp_private_key_t *)&privateKey));
-
-			// Get public key from the private key
-			uint8_t publicKey[COMPRESSED_PUBLIC_KEY_SIZE];
-			getPublicKeyFromPrivateKey(publicKey, (cx_ecfp_private_key_t *)&privateKey);
+			// Get transaction's public key
+			const uint8_t *publicKey = getTransactionPublicKey();
 
 			// Loop while secret nonce is the same as the transaction's secret nonce
 			uint8_t publicNonce[COMPRESSED_PUBLIC_KEY_SIZE];
@@ -108,7 +101,7 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 			} while(!os_secure_memcmp((uint8_t *)secretNonce, (uint8_t *)transaction.secretNonce, sizeof(transaction.secretNonce)));
 
 			// Create single-signer signature from the hash, transaction's blinding factor, secret nonce, public nonce, and public key
-			createSingleSignerSignature(signature, hash, (uint8_t *)transaction.blindingFactor, (uint8_t *)secretNonce, publicNonce, publicKey);
+			createSingleSignerSignature(signature, hash, (uint8_t *)transaction.blindingFactor, (uint8_t *)secretNonce, publicNonce, publicNonce, publicKey);
 		}
 
 		// Catch invalid parameters error
@@ -117,9 +110,6 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 			// Clear the secret nonce
 			explicit_bzero((uint8_t *)secretNonce, sizeof(secretNonce));
 
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
-
 			// Close try
 			CLOSE_TRY;
 
@@ -132,9 +122,6 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 
 			// Clear the secret nonce
 			explicit_bzero((uint8_t *)secretNonce, sizeof(secretNonce));
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
 	}
 
@@ -149,7 +136,7 @@ void processContinueTransactionGetMessageSignatureRequest(unsigned short *respon
 	}
 
 	// Append signature to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)signature, sizeof(signature));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)signature, sizeof(signature));
 
 	*responseLength += sizeof(signature);
 
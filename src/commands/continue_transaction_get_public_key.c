@@ -18,7 +18,7 @@ void processContinueTransactionGetPublicKeyRequest(unsigned short *responseLengt
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength) {
@@ -48,47 +48,20 @@ void processContinueTransactionGetPublicKeyRequest(unsigned short *responseLengt
 		THROW(INVALID_STATE_ERROR);
 	}
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
-	// Initialize public key
-	volatile uint8_t publicKey[COMPRESSED_PUBLIC_KEY_SIZE];
-
-	// Begin try
-	BEGIN_TRY {
-
-		// Try
-		TRY {
-
-			// Get private key from the transaction's blinding factor and throw error if it fails
-			CX_THROW(cx_ecfp_init_private_key_no_throw(CX_CURVE_SECP256K1, (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor), (cx_ecfp_private_key_t *)&privateKey));
-
-			// Get public key from the private key
-			getPublicKeyFromPrivateKey(publicKey, (cx_ecfp_private_key_t *)&privateKey);
-		}
-
-		// Finally
-		FINALLY {
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
-		}
-	}
-
-	// End try
-	END_TRY;
+	// Get transaction's public key
+	const uint8_t *publicKey = getTransactionPublicKey();
 
 	// Check if response with the public key will overflow
-	if(willResponseOverflow(*responseLength, sizeof(publicKey))) {
+	if(willResponseOverflow(*responseLength, COMPRESSED_PUBLIC_KEY_SIZE)) {
 
 		// Throw length error
 		THROW(ERR_APD_LEN);
 	}
 
 	// Append public key to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)publicKey, sizeof(publicKey));
+	memcpy(&getResponseBuffer()[*responseLength], publicKey, COMPRESSED_PUBLIC_KEY_SIZE);
 
-	*responseLength += sizeof(publicKey);
+	*responseLength += COMPRESSED_PUBLIC_KEY_SIZE;
 
 	// Throw success
 	THROW(SWO_SUCCESS);
@@ -18,7 +18,7 @@ void processContinueTransactionGetPublicNonceRequest(unsigned short *responseLen
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength) {
@@ -48,47 +48,20 @@ void processContinueTransactionGetPublicNonceRequest(unsigned short *responseLen
 		THROW(INVALID_STATE_ERROR);
 	}
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
-	// Initialize public nonce
-	volatile uint8_t publicNonce[COMPRESSED_PUBLIC_KEY_SIZE];
-
-	// Begin try
-	BEGIN_TRY {
-
-		// Try
-		TRY {
-
-			// Get private key from the transaction's secret nonce and throw error if it fails
-			CX_THROW(cx_ecfp_init_private_key_no_throw(CX_CURVE_SECP256K1, (uint8_t *)transaction.secretNonce, sizeof(transaction.secretNonce), (cx_ecfp_private_key_t *)&privateKey));
-
-			// Get public nonce from the private key
-			getPublicKeyFromPrivateKey(publicNonce, (cx_ecfp_private_key_t *)&privateKey);
-		}
-
-		// Finally
-		FINALLY {
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
-		}
-	}
-
-	// End try
-	END_TRY;
+	// Get transaction's public nonce
+	const uint8_t *publicNonce = getTransactionPublicNonce();
 
 	// Check if response with the public nonce will overflow
-	if(willResponseOverflow(*responseLength, sizeof(publicNonce))) {
+	if(willResponseOverflow(*responseLength, COMPRESSED_PUBLIC_KEY_SIZE)) {
 
 		// Throw length error
 		THROW(ERR_APD_LEN);
 	}
 
 	// Append public nonce to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)publicNonce, sizeof(publicNonce));
+	memcpy(&getResponseBuffer()[*responseLength], publicNonce, COMPRESSED_PUBLIC_KEY_SIZE);
 
-	*responseLength += sizeof(publicNonce);
+	*responseLength += COMPRESSED_PUBLIC_KEY_SIZE;
 
 	// Throw success
 	THROW(SWO_SUCCESS);
@@ -18,10 +18,10 @@ void processContinueTransactionIncludeOutputRequest(__attribute__((unused)) cons
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != IDENTIFIER_SIZE + sizeof(uint64_t) + sizeof(uint8_t)) {
@@ -93,6 +93,9 @@ void processContinueTransactionIncludeOutputRequest(__attribute__((unused)) cons
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
+	// Set that transaction's public key isn't cached
+	transaction.publicKeyCached = false;
+
 	// Initialize blinding factor
 	volatile uint8_t blindingFactor[BLINDING_FACTOR_SIZE];
 
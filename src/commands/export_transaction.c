@@ -0,0 +1,49 @@
+// Header files
+#include "../common.h"
+#include "export_transaction.h"
+#include "../transaction.h"
+
+
+// Supporting function implementation
+
+// Process export transaction request
+void processExportTransactionRequest(unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
+
+	// Get request's first parameter
+	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's second parameter
+	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+	// Get request's data length
+	const size_t dataLength = getRequestDataLength();
+
+	// Check if parameters or data are invalid
+	if(firstParameter || secondParameter || dataLength) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Check if transaction hasn't been started
+	if(!transaction.started) {
+
+		// Throw invalid state error
+		THROW(INVALID_STATE_ERROR);
+	}
+
+	// Check if response with the exported transaction will overflow
+	if(willResponseOverflow(*responseLength, EXPORTED_TRANSACTION_SIZE)) {
+
+		// Throw length error
+		THROW(ERR_APD_LEN);
+	}
+
+	// Append exported transaction to response
+	exportTransaction(&getResponseBuffer()[*responseLength]);
+
+	*responseLength += EXPORTED_TRANSACTION_SIZE;
+
+	// Throw success
+	THROW(SWO_SUCCESS);
+}
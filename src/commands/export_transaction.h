@@ -0,0 +1,12 @@
+// Header guard
+#ifndef EXPORT_TRANSACTION_H
+#define EXPORT_TRANSACTION_H
+
+
+// Function prototypes
+
+// Process export transaction request
+void processExportTransactionRequest(unsigned short *responseLength, const unsigned char *responseFlags);
+
+
+#endif
@@ -18,20 +18,33 @@ void processFinishDecryptingSlateRequest(unsigned short *responseLength, __attri
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || dataLength != POLY1305_TAG_SIZE) {
+	if(firstParameter || dataLength != POLY1305_TAG_SIZE) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
+	// Get slate session with the handle
+	struct SlateSession *session = getSlateSession(handle);
+
 	// Check if slate decrypting state isn't active or complete
-	if(slate.decryptingState != ACTIVE_SLATE_STATE && slate.decryptingState != COMPLETE_SLATE_STATE) {
+	if(session->decryptingState != ACTIVE_SLATE_STATE && session->decryptingState != COMPLETE_SLATE_STATE) {
+
+		// Throw invalid state error
+		THROW(INVALID_STATE_ERROR);
+	}
+
+	// Check if session cipher version is streaming and slate decrypting state isn't complete
+	if(session->sessionCipherVersion == STREAMING_SLATE_SESSION_CIPHER_VERSION && session->decryptingState != COMPLETE_SLATE_STATE) {
 
 		// Throw invalid state error
 		THROW(INVALID_STATE_ERROR);
@@ -50,7 +63,7 @@ void processFinishDecryptingSlateRequest(unsigned short *responseLength, __attri
 		TRY {
 
 			// Get ChaCha20 Poly1305 expected tag
-			getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&slate.chaCha20Poly1305State, expectedTag);
+			getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&session->chaCha20Poly1305State, expectedTag);
 
 			// Check if tag isn't equal to the expected tag
 			if(os_secure_memcmp((uint8_t *)tag, (uint8_t *)expectedTag, sizeof(expectedTag))) {
@@ -72,19 +85,19 @@ void processFinishDecryptingSlateRequest(unsigned short *responseLength, __attri
 	END_TRY;
 
 	// Check if response with the slate session key will overflow
-	if(willResponseOverflow(*responseLength, sizeof(slate.sessionKey))) {
+	if(willResponseOverflow(*responseLength, sizeof(session->sessionKey))) {
 
 		// Throw length error
 		THROW(ERR_APD_LEN);
 	}
 
 	// Append slate session key to response
-	memcpy(&G_io_apdu_buffer[*responseLength], slate.sessionKey, sizeof(slate.sessionKey));
+	memcpy(&getResponseBuffer()[*responseLength], session->sessionKey, sizeof(session->sessionKey));
 
-	*responseLength += sizeof(slate.sessionKey);
+	*responseLength += sizeof(session->sessionKey);
 
-	// Reset the slate
-	resetSlate();
+	// Reset the slate session
+	resetSlateSession(session);
 
 	// Throw success
 	THROW(SWO_SUCCESS);
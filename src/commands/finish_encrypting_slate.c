@@ -20,17 +20,23 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || dataLength) {
+	if(firstParameter || dataLength) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
+	// Get slate session with the handle
+	struct SlateSession *session = getSlateSession(handle);
+
 	// Check if slate encrypting state isn't active or complete
-	if(slate.encryptingState != ACTIVE_SLATE_STATE && slate.encryptingState != COMPLETE_SLATE_STATE) {
+	if(session->encryptingState != ACTIVE_SLATE_STATE && session->encryptingState != COMPLETE_SLATE_STATE) {
 
 		// Throw invalid state error
 		THROW(INVALID_STATE_ERROR);
@@ -38,7 +44,7 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 
 	// Get ChaCha20 Poly1305 tag
 	uint8_t tag[POLY1305_TAG_SIZE];
-	getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&slate.chaCha20Poly1305State, tag);
+	getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&session->chaCha20Poly1305State, tag);
 
 	// Initialize signature
 	volatile uint8_t signature[MAXIMUM_DER_SIGNATURE_SIZE];
@@ -47,21 +53,17 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 	volatile size_t signatureLength = 0;
 
 	// Check if creating message hash
-	if(slate.messageHashState.header.info) {
+	if(session->messageHashState.header.info) {
 
 		// Set signature length
 		signatureLength = sizeof(signature);
 
-		// Get tag as a string
-		char tagString[sizeof(tag) * HEXADECIMAL_CHARACTER_SIZE];
-		toHexString(tagString, tag, sizeof(tag));
-
-		// Add tag string to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)tagString, sizeof(tagString), NULL, 0));
+		// Add tag as a string to the message hash state
+		addHexStringToHash((cx_hash_t *)&session->messageHashState, tag, sizeof(tag));
 
 		// Add MQS message part seven to the message hash and get the message hash and throw error if it fails
 		uint8_t messageHash[CX_SHA256_SIZE];
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, CX_LAST, (uint8_t *)MQS_MESSAGE_PART_SEVEN, sizeof(MQS_MESSAGE_PART_SEVEN), messageHash, sizeof(messageHash)));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, CX_LAST, (uint8_t *)MQS_MESSAGE_PART_SEVEN, sizeof(MQS_MESSAGE_PART_SEVEN), messageHash, sizeof(messageHash)));
 
 		// Initialize address private key
 		volatile cx_ecfp_private_key_t addressPrivateKey;
@@ -73,7 +75,7 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 			TRY {
 
 				// Get address private key
-				getAddressPrivateKey(&addressPrivateKey, slate.account, slate.index, CX_CURVE_SECP256K1);
+				getAddressPrivateKey(&addressPrivateKey, session->account, session->index, CX_CURVE_SECP256K1);
 
 				// Get signature of the message hash and throw error if it fails
 				CX_THROW(cx_ecdsa_sign_no_throw((cx_ecfp_private_key_t *)&addressPrivateKey, CX_RND_RFC6979 | CX_LAST, CX_SHA256, messageHash, sizeof(messageHash), (uint8_t *)signature, (size_t *)&signatureLength, NULL));
@@ -99,7 +101,7 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 	}
 
 	// Append tag to response
-	memcpy(&G_io_apdu_buffer[*responseLength], tag, sizeof(tag));
+	memcpy(&getResponseBuffer()[*responseLength], tag, sizeof(tag));
 
 	*responseLength += sizeof(tag);
 
@@ -107,13 +109,13 @@ void processFinishEncryptingSlateRequest(unsigned short *responseLength, __attri
 	if(signatureLength) {
 
 		// Append signature to response
-		memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)signature, signatureLength);
+		memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)signature, signatureLength);
 
 		*responseLength += signatureLength;
 	}
 
-	// Reset the slate
-	resetSlate();
+	// Reset the slate session
+	resetSlateSession(session);
 
 	// Throw success
 	THROW(SWO_SUCCESS);
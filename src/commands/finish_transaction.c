@@ -55,10 +55,10 @@ void processFinishTransactionRequest(__attribute__((unused)) const unsigned shor
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(secondParameter || dataLength < COMPRESSED_PUBLIC_KEY_SIZE + COMPRESSED_PUBLIC_KEY_SIZE + sizeof(uint8_t)) {
@@ -541,10 +541,10 @@ void processFinishTransactionUserInteraction(unsigned short *responseLength) {
 	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	uint8_t *data = getRequestData();
 
 	// Get address type from first parameter
 	const enum AddressType addressType = firstParameter;
@@ -691,8 +691,8 @@ void processFinishTransactionUserInteraction(unsigned short *responseLength) {
 	// Initialize signature
 	uint8_t signature[SINGLE_SIGNER_COMPACT_SIGNATURE_SIZE];
 
-	// Create single-signer signature from the message, transaction's blinding factor, transaction's secret nonce, public nonce, and public key
-	createSingleSignerSignature(signature, message, (uint8_t *)transaction.blindingFactor, (uint8_t *)transaction.secretNonce, publicNonce, publicKey);
+	// Create single-signer signature from the message, transaction's blinding factor, transaction's secret nonce, transaction's public nonce, public nonce, and public key
+	createSingleSignerSignature(signature, message, (uint8_t *)transaction.blindingFactor, (uint8_t *)transaction.secretNonce, getTransactionPublicNonce(), publicNonce, publicKey);
 
 	// Initialize payment proof
 	volatile uint8_t *paymentProof;
@@ -827,7 +827,7 @@ void processFinishTransactionUserInteraction(unsigned short *responseLength) {
 	}
 
 	// Append signature to response
-	memcpy(&G_io_apdu_buffer[*responseLength], signature, sizeof(signature));
+	memcpy(&getResponseBuffer()[*responseLength], signature, sizeof(signature));
 
 	*responseLength += sizeof(signature);
 
@@ -835,7 +835,7 @@ void processFinishTransactionUserInteraction(unsigned short *responseLength) {
 	if(paymentProofLength) {
 
 		// Append payment proof to response
-		memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)paymentProof, paymentProofLength);
+		memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)paymentProof, paymentProofLength);
 
 		*responseLength += paymentProofLength;
 	}
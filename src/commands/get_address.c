@@ -20,10 +20,10 @@ void processGetAddressRequest(unsigned short *responseLength, __attribute__((unu
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(secondParameter || dataLength != sizeof(uint32_t) + sizeof(uint32_t)) {
@@ -103,7 +103,7 @@ void processGetAddressRequest(unsigned short *responseLength, __attribute__((unu
 	}
 
 	// Append address to response
-	memcpy(&G_io_apdu_buffer[*responseLength], address, addressLength);
+	memcpy(&getResponseBuffer()[*responseLength], address, addressLength);
 
 	*responseLength += addressLength;
 
@@ -55,10 +55,10 @@ void processGetBulletproofComponentsRequest(unsigned short *responseLength, __at
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(secondParameter || dataLength != sizeof(uint32_t) + IDENTIFIER_SIZE + sizeof(uint64_t) + sizeof(uint8_t)) {
@@ -380,15 +380,15 @@ void processGetBulletproofComponentsRequest(unsigned short *responseLength, __at
 	}
 
 	// Append bulletproof tau x, t one, and t two to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)bulletproofTauX, sizeof(bulletproofTauX));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)bulletproofTauX, sizeof(bulletproofTauX));
 
 	*responseLength += sizeof(bulletproofTauX);
 
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)bulletproofTOne, sizeof(bulletproofTOne));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)bulletproofTOne, sizeof(bulletproofTOne));
 
 	*responseLength += sizeof(bulletproofTOne);
 
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)bulletproofTTwo, sizeof(bulletproofTTwo));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)bulletproofTTwo, sizeof(bulletproofTTwo));
 
 	*responseLength += sizeof(bulletproofTTwo);
 
@@ -17,10 +17,10 @@ void processGetCommitmentRequest(unsigned short *responseLength, __attribute__((
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != sizeof(uint32_t) + IDENTIFIER_SIZE + sizeof(uint64_t) + sizeof(uint8_t)) {
@@ -120,7 +120,7 @@ void processGetCommitmentRequest(unsigned short *responseLength, __attribute__((
 	}
 
 	// Append commitment to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)commitment, sizeof(commitment));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)commitment, sizeof(commitment));
 
 	*responseLength += sizeof(commitment);
 
@@ -27,10 +27,10 @@ void processGetLoginChallengeSignatureRequest(__attribute__((unused)) const unsi
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength <= sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int16_t) || dataLength > sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int16_t) + MAXIMUM_IDENTIFIER_SIZE) {
@@ -135,10 +135,10 @@ void processGetLoginChallengeSignatureRequest(__attribute__((unused)) const unsi
 void processGetLoginChallengeSignatureUserInteraction(unsigned short *responseLength) {
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Get account from data
 	uint32_t account;
@@ -216,11 +216,11 @@ void processGetLoginChallengeSignatureUserInteraction(unsigned short *responseLe
 	}
 
 	// Append login public key and signature to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)loginPublicKey, sizeof(loginPublicKey));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)loginPublicKey, sizeof(loginPublicKey));
 
 	*responseLength += sizeof(loginPublicKey);
 
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)signature, signatureLength);
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)signature, signatureLength);
 
 	*responseLength += signatureLength;
 
@@ -22,10 +22,10 @@ void processGetMqsChallengeSignatureRequest(__attribute__((unused)) const unsign
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || (dataLength != sizeof(uint32_t) + sizeof(uint32_t) && dataLength != sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(int16_t))) {
@@ -155,10 +155,10 @@ void processGetMqsChallengeSignatureRequest(__attribute__((unused)) const unsign
 void processGetMqsChallengeSignatureUserInteraction(unsigned short *responseLength) {
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Get account from data
 	uint32_t account;
@@ -237,7 +237,7 @@ void processGetMqsChallengeSignatureUserInteraction(unsigned short *responseLeng
 	}
 
 	// Append signature to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)signature, signatureLength);
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)signature, signatureLength);
 
 	*responseLength += signatureLength;
 
@@ -18,10 +18,10 @@ void processGetRootPublicKeyRequest(__attribute__((unused)) const unsigned short
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != sizeof(uint32_t)) {
@@ -56,15 +56,12 @@ void processGetRootPublicKeyRequest(__attribute__((unused)) const unsigned short
 void processGetRootPublicKeyUserInteraction(volatile unsigned short *responseLength) {
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Get account from data
 	uint32_t account;
 	memcpy(&account, data, sizeof(account));
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
 	// Initialize root public key
 	volatile uint8_t rootPublicKey[COMPRESSED_PUBLIC_KEY_SIZE];
 
@@ -74,11 +71,8 @@ void processGetRootPublicKeyUserInteraction(volatile unsigned short *responseLen
 		// Try
 		TRY {
 
-			// Get private key
-			getPrivateKeyAndChainCode(&privateKey, NULL, account);
-
-			// Get root public key from the private key
-			getPublicKeyFromPrivateKey(rootPublicKey, (cx_ecfp_private_key_t *)&privateKey);
+			// Get root public key
+			getRootPublicKey(rootPublicKey, account);
 
 			// Check if response with the root public key will overflow
 			if(willResponseOverflow(*responseLength, sizeof(rootPublicKey))) {
@@ -88,7 +82,7 @@ void processGetRootPublicKeyUserInteraction(volatile unsigned short *responseLen
 			}
 
 			// Append root public key to response
-			memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)rootPublicKey, sizeof(rootPublicKey));
+			memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)rootPublicKey, sizeof(rootPublicKey));
 
 			*responseLength += sizeof(rootPublicKey);
 		}
@@ -98,9 +92,6 @@ void processGetRootPublicKeyUserInteraction(volatile unsigned short *responseLen
 
 			// Clear the root public key
 			explicit_bzero((uint8_t *)rootPublicKey, sizeof(rootPublicKey));
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
 	}
 
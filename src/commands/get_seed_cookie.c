@@ -17,10 +17,10 @@ void processGetSeedCookieRequest(unsigned short *responseLength, __attribute__((
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != sizeof(uint32_t)) {
@@ -43,9 +43,6 @@ void processGetSeedCookieRequest(unsigned short *responseLength, __attribute__((
 	// Get seed cookie
 	volatile uint8_t seedCookie[CX_SHA512_SIZE];
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
 	// Initialize public key
 	volatile uint8_t publicKey[COMPRESSED_PUBLIC_KEY_SIZE];
 
@@ -55,11 +52,8 @@ void processGetSeedCookieRequest(unsigned short *responseLength, __attribute__((
 		// Try
 		TRY {
 
-			// Get private key
-			getPrivateKeyAndChainCode(&privateKey, NULL, account);
-
-			// Get public key from the private key
-			getPublicKeyFromPrivateKey(publicKey, (cx_ecfp_private_key_t *)&privateKey);
+			// Get root public key
+			getRootPublicKey(publicKey, account);
 
 			// Get seed cookie from the public key
 			cx_hash_sha512((uint8_t *)publicKey, sizeof(publicKey), (uint8_t *)seedCookie, sizeof(seedCookie));
@@ -70,9 +64,6 @@ void processGetSeedCookieRequest(unsigned short *responseLength, __attribute__((
 
 			// Clear the public key
 			explicit_bzero((uint8_t *)publicKey, sizeof(publicKey));
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
 	}
 
@@ -87,7 +78,7 @@ void processGetSeedCookieRequest(unsigned short *responseLength, __attribute__((
 	}
 
 	// Append seed cookie to response
-	memcpy(&G_io_apdu_buffer[*responseLength], (uint8_t *)seedCookie, sizeof(seedCookie));
+	memcpy(&getResponseBuffer()[*responseLength], (uint8_t *)seedCookie, sizeof(seedCookie));
 
 	*responseLength += sizeof(seedCookie);
 
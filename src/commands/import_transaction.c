@@ -0,0 +1,39 @@
+// Header files
+#include "../common.h"
+#include "import_transaction.h"
+#include "../transaction.h"
+
+
+// Supporting function implementation
+
+// Process import transaction request
+void processImportTransactionRequest(__attribute__((unused)) const unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
+
+	// Reset the transaction
+	resetTransaction();
+
+	// Get request's first parameter
+	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's second parameter
+	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+	// Get request's data length
+	const size_t dataLength = getRequestDataLength();
+
+	// Get request's data
+	const uint8_t *data = getRequestData();
+
+	// Check if parameters or data are invalid
+	if(firstParameter || secondParameter || dataLength != EXPORTED_TRANSACTION_SIZE) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Import transaction from the data
+	importTransaction(data);
+
+	// Throw success
+	THROW(SWO_SUCCESS);
+}
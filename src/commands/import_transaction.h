@@ -0,0 +1,12 @@
+// Header guard
+#ifndef IMPORT_TRANSACTION_H
+#define IMPORT_TRANSACTION_H
+
+
+// Function prototypes
+
+// Process import transaction request
+void processImportTransactionRequest(const unsigned short *responseLength, const unsigned char *responseFlags);
+
+
+#endif
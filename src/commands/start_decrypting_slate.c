@@ -16,9 +16,6 @@
 // Process start decrypting slate request
 void processStartDecryptingSlateRequest(__attribute__((unused)) const unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
 
-	// Reset the slate
-	resetSlate();
-
 	// Get request's first parameter
 	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
 
@@ -26,13 +23,19 @@ void processStartDecryptingSlateRequest(__attribute__((unused)) const unsigned s
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
+
+	// Get session cipher version from first parameter
+	const enum SlateSessionCipherVersion sessionCipherVersion = firstParameter;
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || dataLength <= sizeof(uint32_t) + sizeof(uint32_t) + CHACHA20_NONCE_SIZE) {
+	if((sessionCipherVersion != PADDED_CHUNKS_SLATE_SESSION_CIPHER_VERSION && sessionCipherVersion != STREAMING_SLATE_SESSION_CIPHER_VERSION) || dataLength <= sizeof(uint32_t) + sizeof(uint32_t) + CHACHA20_NONCE_SIZE) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
@@ -99,6 +102,9 @@ void processStartDecryptingSlateRequest(__attribute__((unused)) const unsigned s
 			break;
 	}
 
+	// Start slate session with the handle
+	struct SlateSession *session = startSlateSession(handle);
+
 	// Initialize shared private key
 	volatile uint8_t *sharedPrivateKey = alloca(sharedPrivateKeyLength);
 
@@ -131,7 +137,7 @@ void processStartDecryptingSlateRequest(__attribute__((unused)) const unsigned s
 			}
 
 			// Initialize ChaCha20 Poly1305 with the shared private key and nonce
-			initializeChaCha20Poly1305(&slate.chaCha20Poly1305State, (uint8_t *)sharedPrivateKey, nonce, NULL, 0, 0, NULL);
+			initializeChaCha20Poly1305(&session->chaCha20Poly1305State, (uint8_t *)sharedPrivateKey, nonce, NULL, 0, 0, NULL);
 		}
 
 		// Finally
@@ -146,10 +152,20 @@ void processStartDecryptingSlateRequest(__attribute__((unused)) const unsigned s
 	END_TRY;
 
 	// Create random slate session key
-	cx_rng(slate.sessionKey, sizeof(slate.sessionKey));
+	cx_rng(session->sessionKey, sizeof(session->sessionKey));
+
+	// Set slate's session cipher version
+	session->sessionCipherVersion = sessionCipherVersion;
+
+	// Check if session cipher version is streaming
+	if(sessionCipherVersion == STREAMING_SLATE_SESSION_CIPHER_VERSION) {
+
+		// Initialize slate's session cipher with the slate session key
+		initializeSessionCipher(&session->sessionCipher, session->sessionKey, sizeof(session->sessionKey));
+	}
 
 	// Set that slate decrypting state is ready
-	slate.decryptingState = READY_SLATE_STATE;
+	session->decryptingState = READY_SLATE_STATE;
 
 	// Throw success
 	THROW(SWO_SUCCESS);
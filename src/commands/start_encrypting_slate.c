@@ -17,9 +17,6 @@
 // Process start encrypting slate request
 void processStartEncryptingSlateRequest(unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
 
-	// Reset the slate
-	resetSlate();
-
 	// Get request's first parameter
 	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
 
@@ -27,13 +24,16 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
+
+	// Get handle from second parameter
+	const uint8_t handle = secondParameter;
 
 	// Check if parameters or data are invalid
-	if(firstParameter || secondParameter || dataLength <= sizeof(uint32_t) + sizeof(uint32_t)) {
+	if(firstParameter || dataLength <= sizeof(uint32_t) + sizeof(uint32_t)) {
 
 		// Throw invalid parameters error
 		THROW(INVALID_PARAMETERS_ERROR);
@@ -130,6 +130,9 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 	// Create random nonce
 	cx_rng(nonce, sizeof(nonce));
 
+	// Start slate session with the handle
+	struct SlateSession *session = startSlateSession(handle);
+
 	// Initialize shared private key
 	volatile uint8_t *sharedPrivateKey = alloca(sharedPrivateKeyLength);
 
@@ -162,7 +165,7 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 			}
 
 			// Initialize ChaCha20 Poly1305 with the shared private key and nonce
-			initializeChaCha20Poly1305(&slate.chaCha20Poly1305State, (uint8_t *)sharedPrivateKey, nonce, NULL, 0, 0, NULL);
+			initializeChaCha20Poly1305(&session->chaCha20Poly1305State, (uint8_t *)sharedPrivateKey, nonce, NULL, 0, 0, NULL);
 		}
 
 		// Finally
@@ -180,16 +183,16 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 	if((addressDomain ? addressDomain - address : addressLength) == MQS_ADDRESS_SIZE) {
 
 		// Initialize message hash state
-		cx_sha256_init(&slate.messageHashState);
+		cx_sha256_init(&session->messageHashState);
 
 		// Add MQS message part one to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_ONE, sizeof(MQS_MESSAGE_PART_ONE), NULL, 0));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_ONE, sizeof(MQS_MESSAGE_PART_ONE), NULL, 0));
 
 		// Add address to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)address, addressDomain ? addressDomain - address : addressLength, NULL, 0));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)address, addressDomain ? addressDomain - address : addressLength, NULL, 0));
 
 		// Add MQS message part two to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_TWO, sizeof(MQS_MESSAGE_PART_TWO), NULL, 0));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_TWO, sizeof(MQS_MESSAGE_PART_TWO), NULL, 0));
 
 		// Check if address has a domain
 		if(addressDomain) {
@@ -201,26 +204,26 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 			if(addressPort) {
 
 				// Add address domain to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)&addressDomain[sizeof((char)'@')], addressPort - addressDomain - sizeof((char)'@'), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)&addressDomain[sizeof((char)'@')], addressPort - addressDomain - sizeof((char)'@'), NULL, 0));
 
 				// Add MQS message part three to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
 
 				// Add address port to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)&addressPort[sizeof((char)':')], addressLength - (addressPort - address + sizeof((char)':')), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)&addressPort[sizeof((char)':')], addressLength - (addressPort - address + sizeof((char)':')), NULL, 0));
 			}
 
 			// Otherwise
 			else {
 
 				// Add address domain to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)&addressDomain[sizeof((char)'@')], addressLength - (addressDomain - address + sizeof((char)'@')), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)&addressDomain[sizeof((char)'@')], addressLength - (addressDomain - address + sizeof((char)'@')), NULL, 0));
 
 				// Add MQS message part three to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
 
 				// Add MQS message no port to the message hash state and throw error if it fails
-				CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_NO_PORT, sizeof(MQS_MESSAGE_NO_PORT), NULL, 0));
+				CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_NO_PORT, sizeof(MQS_MESSAGE_NO_PORT), NULL, 0));
 			}
 		}
 
@@ -228,35 +231,26 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 		else {
 
 			// Add MQS message part three to the message hash state and throw error if it fails
-			CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
+			CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_THREE, sizeof(MQS_MESSAGE_PART_THREE), NULL, 0));
 
 			// Add MQS message no port to the message hash state and throw error if it fails
-			CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_NO_PORT, sizeof(MQS_MESSAGE_NO_PORT), NULL, 0));
+			CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_NO_PORT, sizeof(MQS_MESSAGE_NO_PORT), NULL, 0));
 		}
 
 		// Add MQS message part four to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_FOUR, sizeof(MQS_MESSAGE_PART_FOUR), NULL, 0));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_FOUR, sizeof(MQS_MESSAGE_PART_FOUR), NULL, 0));
 
-		// Get nonce as a string
-		char nonceString[sizeof(nonce) * HEXADECIMAL_CHARACTER_SIZE];
-		toHexString(nonceString, nonce, sizeof(nonce));
-
-		// Add nonce string to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)nonceString, sizeof(nonceString), NULL, 0));
+		// Add nonce as a string to the message hash state
+		addHexStringToHash((cx_hash_t *)&session->messageHashState, nonce, sizeof(nonce));
 
 		// Add MQS message part five to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_FIVE, sizeof(MQS_MESSAGE_PART_FIVE), NULL, 0));
-
-		// Get salt as a string
-		const size_t saltStringLength = saltLength * HEXADECIMAL_CHARACTER_SIZE;
-		char *saltString = alloca(saltStringLength);
-		toHexString(saltString, salt, saltLength);
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_FIVE, sizeof(MQS_MESSAGE_PART_FIVE), NULL, 0));
 
-		// Add salt string to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)saltString, saltStringLength, NULL, 0));
+		// Add salt as a string to the message hash state
+		addHexStringToHash((cx_hash_t *)&session->messageHashState, salt, saltLength);
 
 		// Add MQS message part six to the message hash state and throw error if it fails
-		CX_THROW(cx_hash_no_throw((cx_hash_t *)&slate.messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_SIX, sizeof(MQS_MESSAGE_PART_SIX), NULL, 0));
+		CX_THROW(cx_hash_no_throw((cx_hash_t *)&session->messageHashState, 0, (uint8_t *)MQS_MESSAGE_PART_SIX, sizeof(MQS_MESSAGE_PART_SIX), NULL, 0));
 	}
 
 	// Check if response with the nonce and salt will overflow
@@ -267,7 +261,7 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 	}
 
 	// Append nonce to response
-	memcpy(&G_io_apdu_buffer[*responseLength], nonce, sizeof(nonce));
+	memcpy(&getResponseBuffer()[*responseLength], nonce, sizeof(nonce));
 
 	*responseLength += sizeof(nonce);
 
@@ -275,19 +269,19 @@ void processStartEncryptingSlateRequest(unsigned short *responseLength, __attrib
 	if(saltLength) {
 
 		// Append salt to response
-		memcpy(&G_io_apdu_buffer[*responseLength], salt, saltLength);
+		memcpy(&getResponseBuffer()[*responseLength], salt, saltLength);
 
 		*responseLength += saltLength;
 	}
 
 	// Set slate's account
-	slate.account = account;
+	session->account = account;
 
 	// Set slate's index
-	slate.index = index;
+	session->index = index;
 
 	// Set that slate encrypting state is ready
-	slate.encryptingState = READY_SLATE_STATE;
+	session->encryptingState = READY_SLATE_STATE;
 
 	// Throw success
 	THROW(SWO_SUCCESS);
@@ -0,0 +1,95 @@
+// Header files
+#include <string.h>
+#include "../common.h"
+#include "../commitments.h"
+#include "../crypto.h"
+#include "start_getting_commitments.h"
+
+
+// Supporting function implementation
+
+// Process start getting commitments request
+void processStartGettingCommitmentsRequest(__attribute__((unused)) const unsigned short *responseLength, __attribute__((unused)) const unsigned char *responseFlags) {
+
+	// Reset the commitments
+	resetCommitments();
+
+	// Get request's first parameter
+	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's second parameter
+	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+	// Get request's data length
+	const size_t dataLength = getRequestDataLength();
+
+	// Get request's data
+	const uint8_t *data = getRequestData();
+
+	// Check if parameters or data are invalid
+	if(firstParameter || secondParameter || dataLength != sizeof(uint32_t) + IDENTIFIER_SIZE + sizeof(uint8_t)) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Get account from data
+	uint32_t account;
+	memcpy(&account, data, sizeof(account));
+
+	// Check if account is invalid
+	if(account > MAXIMUM_ACCOUNT) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Get identifer depth from data
+	const uint8_t identifierDepth = data[sizeof(account)];
+
+	// Check if identifier depth is invalid
+	if(!identifierDepth || identifierDepth > IDENTIFIER_MAXIMUM_DEPTH) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Get identifier path from data
+	uint32_t identifierPath[IDENTIFIER_MAXIMUM_DEPTH];
+	memcpy(identifierPath, &data[sizeof(account) + sizeof(identifierDepth)], sizeof(identifierPath));
+
+	// Go through all parts in the identifier path
+	for(size_t i = 0; i < ARRAYLEN(identifierPath); ++i) {
+
+		// Convert part from big endian to little endian
+		identifierPath[i] = os_swap_u32(identifierPath[i]);
+	}
+
+	// Get switch type from data
+	const enum SwitchType switchType = data[sizeof(account) + IDENTIFIER_SIZE];
+
+	// Check if switch type is invalid
+	if(switchType != REGULAR_SWITCH_TYPE) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Derive the identifier's parent private key and chain code
+	deriveIdentifierParentKey(&commitments.parentPrivateKey, commitments.parentChainCode, account, identifierPath, identifierDepth);
+
+	// Set commitments's account
+	commitments.account = account;
+
+	// Set commitments's base index to the identifier's last part
+	commitments.baseIndex = identifierPath[identifierDepth - 1];
+
+	// Set commitments's switch type
+	commitments.switchType = switchType;
+
+	// Set that commitments has started
+	commitments.started = true;
+
+	// Throw success
+	THROW(SWO_SUCCESS);
+}
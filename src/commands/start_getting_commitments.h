@@ -0,0 +1,12 @@
+// Header guard
+#ifndef START_GETTING_COMMITMENTS_H
+#define START_GETTING_COMMITMENTS_H
+
+
+// Function prototypes
+
+// Process start getting commitments request
+void processStartGettingCommitmentsRequest(const unsigned short *responseLength, const unsigned char *responseFlags);
+
+
+#endif
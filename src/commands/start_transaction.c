@@ -24,10 +24,10 @@ void processStartTransactionRequest(__attribute__((unused)) const unsigned short
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength < sizeof(uint32_t) + sizeof(uint32_t) + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint8_t)) {
@@ -142,7 +142,7 @@ void processStartTransactionRequest(__attribute__((unused)) const unsigned short
 		}
 
 		// Check if secret nonce index exists and the secret nonce at the index is invalid
-		if(secretNonceIndex && isZeroArraySecure((uint8_t *)storage.transactionSecretNonces[secretNonceIndex - 1], sizeof(storage.transactionSecretNonces[secretNonceIndex - 1]))) {
+		if(secretNonceIndex && isZeroArraySecure((uint8_t *)storage.transactionSecretNonceRecords[secretNonceIndex - 1].encryptedSecretNonce, sizeof(storage.transactionSecretNonceRecords[secretNonceIndex - 1].encryptedSecretNonce))) {
 
 			// Throw invalid parameters error
 			THROW(INVALID_PARAMETERS_ERROR);
@@ -156,6 +156,13 @@ void processStartTransactionRequest(__attribute__((unused)) const unsigned short
 
 		// Set transaction secret nonce index
 		transaction.secretNonceIndex = secretNonceIndex;
+
+		// Check if secret nonce index exists
+		if(secretNonceIndex) {
+
+			// Set transaction's secret nonce sequence number to the sequence number of the secret nonce's record
+			transaction.secretNonceSequenceNumber = storage.transactionSecretNonceRecords[secretNonceIndex - 1].sequenceNumber;
+		}
 	}
 
 	// Otherwise
@@ -178,8 +185,11 @@ void processStartTransactionRequest(__attribute__((unused)) const unsigned short
 		// Set transaction's receive
 		transaction.receive = output;
 
-		// Create transaction's secret nonce
-		createSingleSignerNonces((uint8_t *)transaction.secretNonce, NULL);
+		// Create transaction's secret nonce and public nonce
+		createSingleSignerNonces((uint8_t *)transaction.secretNonce, transaction.publicNonce);
+
+		// Set that transaction's public nonce is cached
+		transaction.publicNonceCached = true;
 	}
 
 	// Set transaction's account
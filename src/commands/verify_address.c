@@ -19,10 +19,10 @@ void processVerifyAddressRequest(__attribute__((unused)) const unsigned short *r
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(secondParameter || dataLength != sizeof(uint32_t) + sizeof(uint32_t)) {
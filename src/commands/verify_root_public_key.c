@@ -17,10 +17,10 @@ void processVerifyRootPublicKeyRequest(__attribute__((unused)) const unsigned sh
 	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
 
 	// Get request's data length
-	const size_t dataLength = G_io_apdu_buffer[APDU_OFF_LC];
+	const size_t dataLength = getRequestDataLength();
 
 	// Get request's data
-	const uint8_t *data = &G_io_apdu_buffer[APDU_OFF_DATA];
+	const uint8_t *data = getRequestData();
 
 	// Check if parameters or data are invalid
 	if(firstParameter || secondParameter || dataLength != sizeof(uint32_t)) {
@@ -40,9 +40,6 @@ void processVerifyRootPublicKeyRequest(__attribute__((unused)) const unsigned sh
 		THROW(INVALID_PARAMETERS_ERROR);
 	}
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
 	// Initialize root public key
 	volatile uint8_t rootPublicKey[COMPRESSED_PUBLIC_KEY_SIZE];
 
@@ -52,11 +49,8 @@ void processVerifyRootPublicKeyRequest(__attribute__((unused)) const unsigned sh
 		// Try
 		TRY {
 
-			// Get private key
-			getPrivateKeyAndChainCode(&privateKey, NULL, account);
-
-			// Get root public key from the private key
-			getPublicKeyFromPrivateKey(rootPublicKey, (cx_ecfp_private_key_t *)&privateKey);
+			// Get root public key
+			getRootPublicKey(rootPublicKey, account);
 
 			// Copy root public key into the public key line buffer
 			toHexString((char *)publicKeyLineBuffer, (uint8_t *)rootPublicKey, sizeof(rootPublicKey));
@@ -68,9 +62,6 @@ void processVerifyRootPublicKeyRequest(__attribute__((unused)) const unsigned sh
 
 			// Clear the root public key
 			explicit_bzero((uint8_t *)rootPublicKey, sizeof(rootPublicKey));
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
 	}
 
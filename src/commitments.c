@@ -0,0 +1,20 @@
+// Header files
+#include <string.h>
+#include "common.h"
+#include "commitments.h"
+
+
+// Global variables
+
+// Commitments
+SESSION_LOCAL struct Commitments commitments;
+
+
+// Supporting function implementation
+
+// Reset commitments
+void resetCommitments(void) {
+
+	// Clear the commitments
+	explicit_bzero(&commitments, sizeof(commitments));
+}
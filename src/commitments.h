@@ -0,0 +1,48 @@
+// Header guard
+#ifndef COMMITMENTS_H
+#define COMMITMENTS_H
+
+
+// Header files
+#include <stdbool.h>
+#include "crypto.h"
+
+
+// Structures
+
+// Commitments
+struct Commitments {
+
+	// Account
+	uint32_t account;
+
+	// Base index
+	uint32_t baseIndex;
+
+	// Switch type
+	enum SwitchType switchType;
+
+	// Parent private key
+	volatile cx_ecfp_private_key_t parentPrivateKey;
+
+	// Parent chain code
+	volatile uint8_t parentChainCode[CHAIN_CODE_SIZE];
+
+	// Started
+	bool started;
+};
+
+
+// Global variables
+
+// Commitments
+extern SESSION_LOCAL struct Commitments commitments;
+
+
+// Function prototypes
+
+// Reset commitments
+void resetCommitments(void);
+
+
+#endif
@@ -4,17 +4,33 @@
 #include <string.h>
 #include "common.h"
 #include "menus.h"
+#include "root_public_key_cache.h"
 #include "state.h"
 
 
+// Definitions
+
+// Hex string hash buffer size
+#define HEX_STRING_HASH_BUFFER_SIZE 64
+
+
 // Constants
 
 // Hexadecimal characters
 static const char HEXADECIMAL_CHARACTERS[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
 
 
+// Global variables
+
+// Chained APDU
+SESSION_LOCAL struct ChainedApdu chainedApdu;
+
+
 // Function prototypes
 
+// Get response buffer size
+static size_t getResponseBufferSize(void);
+
 // Is digit
 bool isDigit(const char character);
 
@@ -30,6 +46,9 @@ void exitApplication(void) {
 	// Reset state
 	resetState();
 
+	// Reset root public key cache
+	resetRootPublicKeyCache();
+
 	// Clear menu buffers
 	clearMenuBuffers();
 
@@ -56,7 +75,70 @@ void exitApplication(void) {
 bool willResponseOverflow(const unsigned short currentLength, const size_t lengthChange) {
 
 	// Return if response's length with the change will overflow
-	return USHRT_MAX - currentLength < lengthChange || currentLength + lengthChange >= sizeof(G_io_apdu_buffer);
+	return USHRT_MAX - currentLength < lengthChange || currentLength + lengthChange >= getResponseBufferSize();
+}
+
+// Reset chained APDU
+void resetChainedApdu(void) {
+
+	// Clear the chained APDU
+	explicit_bzero(&chainedApdu, sizeof(chainedApdu));
+}
+
+// Get request data
+uint8_t *getRequestData(void) {
+
+	// Check if request was chained
+	if(chainedApdu.requestState == COMPLETE_CHAINED_REQUEST_STATE) {
+
+		// Return chained request's data
+		return chainedApdu.buffer;
+	}
+
+	// Return request's data
+	return &G_io_apdu_buffer[APDU_OFF_DATA];
+}
+
+// Get request data length
+size_t getRequestDataLength(void) {
+
+	// Check if request was chained
+	if(chainedApdu.requestState == COMPLETE_CHAINED_REQUEST_STATE) {
+
+		// Return chained request's data length
+		return chainedApdu.requestDataLength;
+	}
+
+	// Return request's data length
+	return G_io_apdu_buffer[APDU_OFF_LC];
+}
+
+// Get response buffer
+uint8_t *getResponseBuffer(void) {
+
+	// Check if creating a chained response
+	if(chainedApdu.isCreatingResponse) {
+
+		// Return the part of the chained APDU buffer after the request's data
+		return &chainedApdu.buffer[chainedApdu.requestDataLength];
+	}
+
+	// Return APDU buffer
+	return G_io_apdu_buffer;
+}
+
+// Get response buffer size
+size_t getResponseBufferSize(void) {
+
+	// Check if creating a chained response
+	if(chainedApdu.isCreatingResponse) {
+
+		// Return the size of the part of the chained APDU buffer after the request's data
+		return sizeof(chainedApdu.buffer) - chainedApdu.requestDataLength;
+	}
+
+	// Return APDU buffer size
+	return sizeof(G_io_apdu_buffer);
 }
 
 // Swap endianness
@@ -82,6 +164,26 @@ void toHexString(char *result, const uint8_t *value, const size_t length) {
 	}
 }
 
+// Add hex string to hash
+void addHexStringToHash(cx_hash_t *hash, const uint8_t *value, const size_t length) {
+
+	// Initialize buffer
+	char buffer[HEX_STRING_HASH_BUFFER_SIZE];
+
+	// Go through all parts of the value that fit in the buffer
+	for(size_t i = 0; i < length; i += sizeof(buffer) / HEXADECIMAL_CHARACTER_SIZE) {
+
+		// Get part's length
+		const size_t partLength = MIN(length - i, sizeof(buffer) / HEXADECIMAL_CHARACTER_SIZE);
+
+		// Get part as a string
+		toHexString(buffer, &value[i], partLength);
+
+		// Add part string to the hash and throw error if it fails
+		CX_THROW(cx_hash_no_throw(hash, 0, (uint8_t *)buffer, partLength * HEXADECIMAL_CHARACTER_SIZE, NULL, 0));
+	}
+}
+
 // Get string length
 size_t getStringLength(uint64_t value) {
 
@@ -39,6 +39,22 @@
 	#define ERR_APD_LEN (ERR_APD_RANGE + ERR_GEN_SUB_07)
 #endif
 
+// More response data status
+#define MORE_RESPONSE_DATA_STATUS (SWO_SUCCESS + ERR_GEN_SUB_01)
+
+// Check if target is Nano S
+#ifdef TARGET_NANOS
+
+	// Chained APDU buffer size
+	#define CHAINED_APDU_BUFFER_SIZE 512
+
+// Otherwise
+#else
+
+	// Chained APDU buffer size
+	#define CHAINED_APDU_BUFFER_SIZE 1024
+#endif
+
 
 // Constants
 
@@ -80,6 +96,59 @@ enum AddressType {
 	TOR_ADDRESS_TYPE
 };
 
+// Chained request state
+enum ChainedRequestState {
+
+	// Inactive chained request state
+	INACTIVE_CHAINED_REQUEST_STATE,
+
+	// Receiving chained request state
+	RECEIVING_CHAINED_REQUEST_STATE,
+
+	// Complete chained request state
+	COMPLETE_CHAINED_REQUEST_STATE
+};
+
+
+// Structures
+
+// Chained APDU
+struct ChainedApdu {
+
+	// Buffer
+	uint8_t buffer[CHAINED_APDU_BUFFER_SIZE];
+
+	// Request state
+	enum ChainedRequestState requestState;
+
+	// Request instruction
+	uint8_t requestInstruction;
+
+	// Request first parameter
+	uint8_t requestFirstParameter;
+
+	// Request second parameter
+	uint8_t requestSecondParameter;
+
+	// Request data length
+	size_t requestDataLength;
+
+	// Is creating response
+	bool isCreatingResponse;
+
+	// Response length
+	size_t responseLength;
+
+	// Response offset
+	size_t responseOffset;
+};
+
+
+// Global variables
+
+// Chained APDU
+extern SESSION_LOCAL struct ChainedApdu chainedApdu;
+
 
 // Function prototypes
 
@@ -89,12 +158,27 @@ void exitApplication(void);
 // Will response overflow
 bool willResponseOverflow(const unsigned short currentLength, const size_t change);
 
+// Reset chained APDU
+void resetChainedApdu(void);
+
+// Get request data
+uint8_t *getRequestData(void);
+
+// Get request data length
+size_t getRequestDataLength(void);
+
+// Get response buffer
+uint8_t *getResponseBuffer(void);
+
 // Swap endianness
 void swapEndianness(uint8_t *value, const size_t length);
 
 // To hex string
 void toHexString(char *result, const uint8_t *value, const size_t length);
 
+// Add hex string to hash
+void addHexStringToHash(cx_hash_t *hash, const uint8_t *value, const size_t length);
+
 // Get string length
 size_t getStringLength(uint64_t value);
 
@@ -11,6 +11,8 @@
 #include "generators.h"
 #include "menus.h"
 #include "mqs.h"
+#include "performance_counters.h"
+#include "root_public_key_cache.h"
 #include "tor.h"
 
 
@@ -25,9 +27,6 @@
 // Node size
 #define NODE_SIZE 64
 
-// Chain code size
-#define CHAIN_CODE_SIZE 32
-
 // BIP44 path coin type index
 #define BIP44_PATH_COIN_TYPE_INDEX 1
 
@@ -55,6 +54,12 @@
 // Bits to prove
 #define BITS_TO_PROVE (sizeof(uint64_t) * BITS_IN_A_BYTE)
 
+// Quadratic residue limbs
+#define QUADRATIC_RESIDUE_LIMBS (PUBLIC_KEY_COMPONENT_SIZE / sizeof(uint32_t))
+
+// Quadratic residue iterations
+#define QUADRATIC_RESIDUE_ITERATIONS (PUBLIC_KEY_COMPONENT_SIZE * BITS_IN_A_BYTE * 2)
+
 
 // Constants
 
@@ -110,6 +115,9 @@ static const char ADDRESS_PRIVATE_KEY_HASH_KEY[] = {'G', 'r', 'i', 'n', 'b', 'o'
 // Derive child key
 static void deriveChildKey(volatile cx_ecfp_private_key_t *privateKey, volatile uint8_t *chainCode, const uint32_t account, const uint32_t *path, const size_t pathLength, const bool useProvidedPrivateKeyAndChainCode);
 
+// Get blinding factor from child key
+static void getBlindingFactorFromChildKey(volatile uint8_t *blindingFactor, const cx_ecfp_private_key_t *childPrivateKey, const uint64_t value, const enum SwitchType switchType);
+
 // Bulletproof update commitment
 static void bulletproofUpdateCommitment(volatile uint8_t *commitment, const uint8_t *leftPart, const uint8_t *rightPart);
 
@@ -119,8 +127,8 @@ static void createScalarsFromChaCha20(volatile uint8_t *firstScalar, volatile ui
 // Use LR generator
 static void useLrGenerator(volatile uint8_t *t0, volatile uint8_t *t1, volatile uint8_t *t2, const uint8_t *y, const uint8_t *z, const uint8_t *nonce, const uint64_t value);
 
-// Is quadratic residue
-static bool isQuadraticResidue(const uint8_t *component);
+// Get secp256k1 y squared
+static void getSecp256k1YSquared(uint8_t *ySquared, const uint8_t *publicKey);
 
 // Compare big numbers
 static int compareBigNumbers(const uint8_t *firstValue, const uint8_t *secondValue, const size_t valueLength);
@@ -144,6 +152,9 @@ void getPrivateKeyAndChainCode(volatile cx_ecfp_private_key_t *privateKey, volat
 	// Initialize node
 	volatile uint8_t node[NODE_SIZE];
 
+	// Start derivation performance counter
+	START_PERFORMANCE_COUNTER(DERIVATION_PERFORMANCE_STAGE, 0);
+
 	// Begin try
 	BEGIN_TRY {
 
@@ -169,6 +180,9 @@ void getPrivateKeyAndChainCode(volatile cx_ecfp_private_key_t *privateKey, volat
 
 			// Clear the node
 			explicit_bzero((uint8_t *)node, sizeof(node));
+
+			// Stop derivation performance counter
+			STOP_PERFORMANCE_COUNTER(DERIVATION_PERFORMANCE_STAGE);
 		}
 	}
 
@@ -210,18 +224,18 @@ void getPublicKeyFromPrivateKey(volatile uint8_t *publicKey, const cx_ecfp_priva
 	END_TRY;
 }
 
-// Derive blinding factor
-void deriveBlindingFactor(volatile uint8_t *blindingFactor, const uint32_t account, const uint64_t value, const uint32_t *path, const size_t pathLength, const enum SwitchType switchType) {
+// Get root public key
+void getRootPublicKey(volatile uint8_t *rootPublicKey, const uint32_t account) {
 
-	// Initialize child private key and chain code
-	volatile cx_ecfp_private_key_t childPrivateKey;
-	volatile uint8_t childChainCode[CHAIN_CODE_SIZE];
+	// Check if the root public key for the account is cached
+	if(getCachedRootPublicKey(rootPublicKey, account)) {
 
-	// Initialize hash
-	volatile cx_sha256_t hash;
+		// Return
+		return;
+	}
 
-	// Initialize publicKeyGenerator
-	volatile uint8_t publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE + sizeof(GENERATOR_J)] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX};
+	// Initialize private key
+	volatile cx_ecfp_private_key_t privateKey;
 
 	// Begin try
 	BEGIN_TRY {
@@ -229,81 +243,95 @@ void deriveBlindingFactor(volatile uint8_t *blindingFactor, const uint32_t accou
 		// Try
 		TRY {
 
-			// Derive child's private key and chain code at path
-			deriveChildKey(&childPrivateKey, childChainCode, account, path, pathLength, false);
+			// Get private key
+			getPrivateKeyAndChainCode(&privateKey, NULL, account);
 
-			// Check switch type
-			switch(switchType) {
+			// Get root public key from the private key
+			getPublicKeyFromPrivateKey(rootPublicKey, (cx_ecfp_private_key_t *)&privateKey);
 
-				// No switch type
-				case NO_SWITCH_TYPE:
+			// Cache the root public key for the account
+			cacheRootPublicKey((uint8_t *)rootPublicKey, account);
+		}
 
-					// Set blinding factor to the child's private key
-					memcpy((uint8_t *)blindingFactor, (uint8_t *)childPrivateKey.d, childPrivateKey.d_len);
+		// Finally
+		FINALLY {
 
-					// Break
-					break;
+			// Clear the private key
+			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
+		}
+	}
 
-				// Regular switch type
-				case REGULAR_SWITCH_TYPE: {
+	// End try
+	END_TRY;
+}
 
-					// Get commitment from value and child's private key
-					uint8_t *commitment = (uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE];
-					commitValue(commitment, value, (uint8_t *)childPrivateKey.d, true);
+// Derive blinding factor
+void deriveBlindingFactor(volatile uint8_t *blindingFactor, const uint32_t account, const uint64_t value, const uint32_t *path, const size_t pathLength, const enum SwitchType switchType) {
 
-					// Add commitment to the hash and throw error if it fails
-					cx_sha256_init((cx_sha256_t *)&hash);
-					CX_THROW(cx_hash_no_throw((cx_hash_t *)&hash, 0, commitment, COMMITMENT_SIZE, NULL, 0));
+	// Initialize child private key and chain code
+	volatile cx_ecfp_private_key_t childPrivateKey;
+	volatile uint8_t childChainCode[CHAIN_CODE_SIZE];
 
-					// Get product of the generator public key and the child's private key and throw error if it fails
-					memcpy((uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE], GENERATOR_J, sizeof(GENERATOR_J));
-					CX_THROW(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, (uint8_t *)publicKeyGenerator, (uint8_t *)childPrivateKey.d, BLINDING_FACTOR_SIZE));
+	// Begin try
+	BEGIN_TRY {
 
-					// Check if the result has an x component of zero
-					if(isZeroArraySecure((uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
+		// Try
+		TRY {
 
-						// Throw internal error error
-						THROW(INTERNAL_ERROR_ERROR);
-					}
+			// Derive child's private key and chain code at path
+			deriveChildKey(&childPrivateKey, childChainCode, account, path, pathLength, false);
 
-					// Compress the result
-					publicKeyGenerator[0] = (publicKeyGenerator[sizeof(publicKeyGenerator) - 1] & 1) ? ODD_COMPRESSED_PUBLIC_KEY_PREFIX : EVEN_COMPRESSED_PUBLIC_KEY_PREFIX;
+			// Get blinding factor from the child's private key
+			getBlindingFactorFromChildKey(blindingFactor, (cx_ecfp_private_key_t *)&childPrivateKey, value, switchType);
+		}
 
-					// Add result to the hash and get the blinding factor and throw error if it fails
-					CX_THROW(cx_hash_no_throw((cx_hash_t *)&hash, CX_LAST, (uint8_t *)publicKeyGenerator, COMPRESSED_PUBLIC_KEY_SIZE, (uint8_t *)blindingFactor, BLINDING_FACTOR_SIZE));
+		// Finally
+		FINALLY {
 
-					// Check if the blinding factor overflows
-					if(compareBigNumbers((uint8_t *)blindingFactor, SECP256K1_CURVE_ORDER, BLINDING_FACTOR_SIZE) >= 0) {
+			// Clear the child private key and chain code
+			explicit_bzero((cx_ecfp_private_key_t *)&childPrivateKey, sizeof(childPrivateKey));
+			explicit_bzero((uint8_t *)childChainCode, sizeof(childChainCode));
+		}
+	}
 
-						// Throw internal error error
-						THROW(INTERNAL_ERROR_ERROR);
-					}
+	// End try
+	END_TRY;
+}
 
-					// Add the child's private key to the blinding factor and throw error if it fails
-					CX_THROW(cx_math_addm_no_throw((uint8_t *)blindingFactor, (uint8_t *)blindingFactor, (uint8_t *)childPrivateKey.d, SECP256K1_CURVE_ORDER, BLINDING_FACTOR_SIZE));
+// Derive identifier parent key
+void deriveIdentifierParentKey(volatile cx_ecfp_private_key_t *parentPrivateKey, volatile uint8_t *parentChainCode, const uint32_t account, const uint32_t *path, const size_t pathLength) {
 
-					// Check if blinding factor isn't a valid secret key
-					if(!isValidSecp256k1PrivateKey((uint8_t *)blindingFactor, BLINDING_FACTOR_SIZE)) {
+	// Derive parent's private key and chain code at the path without its last part
+	deriveChildKey(parentPrivateKey, parentChainCode, account, path, pathLength - 1, false);
+}
 
-						// Throw internal error error
-						THROW(INTERNAL_ERROR_ERROR);
-					}
+// Derive blinding factor from parent key
+void deriveBlindingFactorFromParentKey(volatile uint8_t *blindingFactor, const cx_ecfp_private_key_t *parentPrivateKey, const uint8_t *parentChainCode, const uint32_t index, const uint64_t value, const enum SwitchType switchType) {
 
-					// Break
-					break;
-				}
-			}
+	// Initialize child private key and chain code
+	volatile cx_ecfp_private_key_t childPrivateKey;
+	volatile uint8_t childChainCode[CHAIN_CODE_SIZE];
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Set child's private key and chain code to the parent's private key and chain code
+			memcpy((cx_ecfp_private_key_t *)&childPrivateKey, parentPrivateKey, sizeof(childPrivateKey));
+			memcpy((uint8_t *)childChainCode, parentChainCode, sizeof(childChainCode));
+
+			// Derive child's private key and chain code at the index
+			deriveChildKey(&childPrivateKey, childChainCode, 0, &index, 1, true);
+
+			// Get blinding factor from the child's private key
+			getBlindingFactorFromChildKey(blindingFactor, (cx_ecfp_private_key_t *)&childPrivateKey, value, switchType);
 		}
 
 		// Finally
 		FINALLY {
 
-			// Clear the public key generator
-			explicit_bzero((uint8_t *)publicKeyGenerator, sizeof(publicKeyGenerator));
-
-			// Clear the hash
-			explicit_bzero((cx_sha256_t *)&hash, sizeof(hash));
-
 			// Clear the child private key and chain code
 			explicit_bzero((cx_ecfp_private_key_t *)&childPrivateKey, sizeof(childPrivateKey));
 			explicit_bzero((uint8_t *)childChainCode, sizeof(childChainCode));
@@ -321,6 +349,9 @@ void commitValue(volatile uint8_t *commitment, const uint64_t value, const uint8
 	volatile uint8_t valueGenerator[PUBLIC_KEY_PREFIX_SIZE + sizeof(GENERATOR_H)] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX};
 	volatile uint8_t blindGenerator[PUBLIC_KEY_PREFIX_SIZE + sizeof(GENERATOR_G)] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX};
 
+	// Start commitment performance counter
+	START_PERFORMANCE_COUNTER(COMMITMENT_PERFORMANCE_STAGE, 0);
+
 	// Begin try
 	BEGIN_TRY {
 
@@ -386,6 +417,9 @@ void commitValue(volatile uint8_t *commitment, const uint64_t value, const uint8
 			// Clear the generators
 			explicit_bzero((uint8_t *)valueGenerator, sizeof(valueGenerator));
 			explicit_bzero((uint8_t *)blindGenerator, sizeof(blindGenerator));
+
+			// Stop commitment performance counter
+			STOP_PERFORMANCE_COUNTER(COMMITMENT_PERFORMANCE_STAGE);
 		}
 	}
 
@@ -396,9 +430,6 @@ void commitValue(volatile uint8_t *commitment, const uint64_t value, const uint8
 // Get rewind nonce
 void getRewindNonce(volatile uint8_t *rewindNonce, const uint32_t account, const uint8_t *commitment) {
 
-	// Initialize private key
-	volatile cx_ecfp_private_key_t privateKey;
-
 	// Initialize public key
 	volatile uint8_t publicKey[COMPRESSED_PUBLIC_KEY_SIZE];
 
@@ -411,11 +442,8 @@ void getRewindNonce(volatile uint8_t *rewindNonce, const uint32_t account, const
 		// Try
 		TRY {
 
-			// Get private key
-			getPrivateKeyAndChainCode(&privateKey, NULL, account);
-
-			// Get public key from the private key
-			getPublicKeyFromPrivateKey(publicKey, (cx_ecfp_private_key_t *)&privateKey);
+			// Get root public key
+			getRootPublicKey(publicKey, account);
 
 			// Get rewind hash from the public key
 			getBlake2b(rewindHash, sizeof(rewindHash), (uint8_t *)publicKey, sizeof(publicKey), NULL, 0);
@@ -439,9 +467,6 @@ void getRewindNonce(volatile uint8_t *rewindNonce, const uint32_t account, const
 
 			// Clear the public key
 			explicit_bzero((uint8_t *)publicKey, sizeof(publicKey));
-
-			// Clear the private key
-			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
 	}
 
@@ -668,30 +693,36 @@ void createSingleSignerNonces(uint8_t *secretNonce, uint8_t *publicNonce) {
 }
 
 // Create single-signer signature
-void createSingleSignerSignature(volatile uint8_t *signature, const uint8_t *message, const uint8_t *blindingFactor, const uint8_t *secretNonce, const uint8_t *publicNonce, const uint8_t *publicKey) {
-
-	// Get the product of the secret nonce and its generator and throw error if it fails
-	uint8_t generator[PUBLIC_KEY_PREFIX_SIZE + sizeof(GENERATOR_G)] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX};
-	memcpy(&generator[PUBLIC_KEY_PREFIX_SIZE], GENERATOR_G, sizeof(GENERATOR_G));
+void createSingleSignerSignature(volatile uint8_t *signature, const uint8_t *message, const uint8_t *blindingFactor, const uint8_t *secretNonce, const uint8_t *signerPublicNonce, const uint8_t *publicNonce, const uint8_t *publicKey) {
 
-	CX_THROW(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, generator, secretNonce, NONCE_SIZE));
-
-	// Check if the result has an x component of zero
-	if(isZeroArraySecure(&generator[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
+	// Check if the signer's public nonce has an x component of zero
+	if(isZeroArraySecure(&signerPublicNonce[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
 
 		// Throw internal error error
 		THROW(INTERNAL_ERROR_ERROR);
 	}
 
-	// Set signature's r component
+	// Set signature's r component to the signer's public nonce's x component
 	uint8_t *r = (uint8_t *)signature;
-	memcpy(r, &generator[PUBLIC_KEY_PREFIX_SIZE], SCALAR_SIZE);
+	memcpy(r, &signerPublicNonce[PUBLIC_KEY_PREFIX_SIZE], SCALAR_SIZE);
 	swapEndianness(r, SCALAR_SIZE);
 
-	// Uncompress public nonce
-	uint8_t *uncompressedPublicNonce = generator;
-	memcpy(uncompressedPublicNonce, publicNonce, COMPRESSED_PUBLIC_KEY_SIZE);
-	uncompressSecp256k1PublicKey(uncompressedPublicNonce);
+	// Check if the public nonce is the signer's public nonce
+	bool publicNonceIsQuadraticResidue;
+	if(!memcmp(publicNonce, signerPublicNonce, COMPRESSED_PUBLIC_KEY_SIZE)) {
+
+		// Set that the public nonce's y component is quadratic residue since single-signer nonces are always created that way
+		publicNonceIsQuadraticResidue = true;
+	}
+
+	// Otherwise
+	else {
+
+		// Uncompress public nonce and get if its y component is quadratic residue
+		uint8_t uncompressedPublicNonce[UNCOMPRESSED_PUBLIC_KEY_SIZE];
+		memcpy(uncompressedPublicNonce, publicNonce, COMPRESSED_PUBLIC_KEY_SIZE);
+		publicNonceIsQuadraticResidue = uncompressSecp256k1PublicKey(uncompressedPublicNonce);
+	}
 
 	// Get signature hash from the public nonce's x component, public key, and message and throw error if it fails
 	cx_sha256_t hash;
@@ -716,8 +747,8 @@ void createSingleSignerSignature(volatile uint8_t *signature, const uint8_t *mes
 			// Multiply blinding factor by the signature hash and throw error if it fails
 			CX_THROW(cx_math_multm_no_throw((uint8_t *)s, blindingFactor, signatureHash, SECP256K1_CURVE_ORDER, sizeof(s)));
 
-			// Check if the uncompressed public nonce's y component is quadratic residue
-			if(isQuadraticResidue(&uncompressedPublicNonce[PUBLIC_KEY_PREFIX_SIZE + PUBLIC_KEY_COMPONENT_SIZE])) {
+			// Check if the public nonce's y component is quadratic residue
+			if(publicNonceIsQuadraticResidue) {
 
 				// Add secret nonce to the result and throw error if it fails
 				CX_THROW(cx_math_addm_no_throw((uint8_t *)s, (uint8_t *)s, secretNonce, SECP256K1_CURVE_ORDER, sizeof(s)));
@@ -865,6 +896,106 @@ size_t decryptData(volatile uint8_t *result, const uint8_t *data, const size_t d
 	return decryptedDataLength;
 }
 
+// Initialize session cipher
+void initializeSessionCipher(volatile struct SessionCipher *sessionCipher, const uint8_t *key, const size_t keyLength) {
+
+	// Initialize the session cipher's key with the key and throw error if it fails
+	CX_THROW(cx_aes_init_key_no_throw(key, keyLength, (cx_aes_key_t *)&sessionCipher->key));
+
+	// Clear the session cipher's chaining value
+	explicit_bzero((uint8_t *)sessionCipher->chainingValue, sizeof(sessionCipher->chainingValue));
+}
+
+// Get session cipher encrypted data length
+size_t getSessionCipherEncryptedDataLength(const size_t dataLength, const bool isLastData) {
+
+	// Return encrypted data length with padding only if it's the last data
+	return isLastData ? getEncryptedDataLength(dataLength) : dataLength;
+}
+
+// Encrypt session cipher data
+void encryptSessionCipherData(volatile struct SessionCipher *sessionCipher, volatile uint8_t *result, const uint8_t *data, const size_t dataLength, const bool isLastData) {
+
+	// Check if data isn't the last data and it's not block aligned
+	if(!isLastData && (!dataLength || dataLength % CX_AES_BLOCK_SIZE)) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Get block aligned data length
+	const size_t alignedDataLength = dataLength - dataLength % CX_AES_BLOCK_SIZE;
+
+	// Initialize block
+	volatile uint8_t block[CX_AES_BLOCK_SIZE];
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Check if data has a full block
+			if(alignedDataLength) {
+
+				// Go through all bytes in the first block
+				for(size_t i = 0; i < CX_AES_BLOCK_SIZE; ++i) {
+
+					// Chain the byte with the session cipher's chaining value so a zero IV continues the previous data's CBC chain
+					block[i] = data[i] ^ sessionCipher->chainingValue[i];
+				}
+
+				// Encrypt the first block with the session cipher's key and throw error if it fails
+				size_t length = sizeof(block);
+				CX_THROW(cx_aes_no_throw((cx_aes_key_t *)&sessionCipher->key, CX_ENCRYPT | CX_PAD_NONE | CX_CHAIN_CBC | CX_LAST, (uint8_t *)block, sizeof(block), (uint8_t *)result, &length));
+
+				// Check if data has more full blocks
+				if(alignedDataLength > CX_AES_BLOCK_SIZE) {
+
+					// Encrypt the remaining full blocks with the session cipher's key using the first encrypted block as the IV and throw error if it fails
+					length = alignedDataLength - CX_AES_BLOCK_SIZE;
+					CX_THROW(cx_aes_iv_no_throw((cx_aes_key_t *)&sessionCipher->key, CX_ENCRYPT | CX_PAD_NONE | CX_CHAIN_CBC | CX_LAST, (uint8_t *)result, CX_AES_BLOCK_SIZE, &data[CX_AES_BLOCK_SIZE], alignedDataLength - CX_AES_BLOCK_SIZE, (uint8_t *)&result[CX_AES_BLOCK_SIZE], &length));
+				}
+
+				// Set the session cipher's chaining value to the last encrypted block
+				memcpy((uint8_t *)sessionCipher->chainingValue, (uint8_t *)&result[alignedDataLength - CX_AES_BLOCK_SIZE], sizeof(sessionCipher->chainingValue));
+			}
+
+			// Check if data is the last data
+			if(isLastData) {
+
+				// Pad the data's final partial block
+				memcpy((uint8_t *)block, &data[alignedDataLength], dataLength - alignedDataLength);
+				memset((uint8_t *)&block[dataLength - alignedDataLength], sizeof(block) - (dataLength - alignedDataLength), sizeof(block) - (dataLength - alignedDataLength));
+
+				// Go through all bytes in the final block
+				for(size_t i = 0; i < CX_AES_BLOCK_SIZE; ++i) {
+
+					// Chain the byte with the session cipher's chaining value so a zero IV continues the previous data's CBC chain
+					block[i] ^= sessionCipher->chainingValue[i];
+				}
+
+				// Encrypt the final block with the session cipher's key and throw error if it fails
+				size_t length = sizeof(block);
+				CX_THROW(cx_aes_no_throw((cx_aes_key_t *)&sessionCipher->key, CX_ENCRYPT | CX_PAD_NONE | CX_CHAIN_CBC | CX_LAST, (uint8_t *)block, sizeof(block), (uint8_t *)&result[alignedDataLength], &length));
+
+				// Set the session cipher's chaining value to the final encrypted block
+				memcpy((uint8_t *)sessionCipher->chainingValue, (uint8_t *)&result[alignedDataLength], sizeof(sessionCipher->chainingValue));
+			}
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the block
+			explicit_bzero((uint8_t *)block, sizeof(block));
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
 // Get X25519 private key from Ed25519 private key
 void getX25519PrivateKeyFromEd25519PrivateKey(volatile cx_ecfp_private_key_t *x25519PrivateKey, const cx_ecfp_private_key_t *ed25519PrivateKey) {
 
@@ -1300,11 +1431,16 @@ bool isValidSecp256k1PublicKey(const uint8_t *publicKey, const size_t length) {
 		// Try
 		TRY {
 
-			// Uncompress the public key
-			uint8_t uncompressedPublicKey[UNCOMPRESSED_PUBLIC_KEY_SIZE];
-			memcpy(uncompressedPublicKey, publicKey, length);
+			// Get the public key's y squared
+			uint8_t ySquared[PUBLIC_KEY_COMPONENT_SIZE];
+			getSecp256k1YSquared(ySquared, publicKey);
 
-			uncompressSecp256k1PublicKey(uncompressedPublicKey);
+			// Check if the y squared isn't quadratic residue
+			if(!isQuadraticResidue(ySquared)) {
+
+				// Throw invalid parameters error
+				THROW(INVALID_PARAMETERS_ERROR);
+			}
 		}
 
 		// Catch all errors
@@ -1329,42 +1465,104 @@ bool isValidSecp256k1PublicKey(const uint8_t *publicKey, const size_t length) {
 	return true;
 }
 
-// Uncompress secp256k1 public key
-void uncompressSecp256k1PublicKey(uint8_t *publicKey) {
+// Is quadratic residue
+bool isQuadraticResidue(const uint8_t *component) {
 
-	// Get public key's x component
-	const uint8_t *x = &publicKey[PUBLIC_KEY_PREFIX_SIZE];
+	// Initialize value and modulus as little endian limbs
+	volatile uint32_t value[QUADRATIC_RESIDUE_LIMBS];
+	uint32_t modulus[QUADRATIC_RESIDUE_LIMBS];
 
-	// Check if public key's prefix is invalid or its x component overflows
-	if((publicKey[0] != EVEN_COMPRESSED_PUBLIC_KEY_PREFIX && publicKey[0] != ODD_COMPRESSED_PUBLIC_KEY_PREFIX) || compareBigNumbers(x, SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE) >= 0) {
+	// Go through all limbs
+	for(size_t i = 0; i < QUADRATIC_RESIDUE_LIMBS; ++i) {
 
-		// Throw invalid parameters error
-		THROW(INVALID_PARAMETERS_ERROR);
+		// Set value's limb to the component's limb
+		value[i] = U4BE(component, PUBLIC_KEY_COMPONENT_SIZE - (i + 1) * sizeof(uint32_t));
+
+		// Set modulus's limb to the secp256k1 curve prime's limb
+		modulus[i] = U4BE(SECP256K1_CURVE_PRIME, sizeof(SECP256K1_CURVE_PRIME) - (i + 1) * sizeof(uint32_t));
 	}
 
-	// Get y squared as x cubed plus seven and throw error if it fails
-	uint8_t ySquared[PUBLIC_KEY_COMPONENT_SIZE];
-	const uint8_t three = 3;
-	CX_THROW(cx_math_powm_no_throw(ySquared, x, &three, sizeof(three), SECP256K1_CURVE_PRIME, sizeof(ySquared)));
+	// Initialize negate
+	uint32_t negate = 0;
 
-	const uint8_t seven[SCALAR_SIZE] = {
-		[SCALAR_SIZE - 1] = 7,
-	};
-	CX_THROW(cx_math_addm_no_throw(ySquared, ySquared, seven, SECP256K1_CURVE_PRIME, sizeof(ySquared)));
+	// Go through enough iterations for the value to reach zero since each iteration reduces the value's and modulus's combined bit length
+	for(size_t i = 0; i < QUADRATIC_RESIDUE_ITERATIONS; ++i) {
 
-	// Return if the y squared isn't quadratic residue
-	if(!isQuadraticResidue(ySquared)) {
+		// Get mask for if the value is odd
+		const uint32_t oddMask = -(value[0] & 1);
 
-		// Throw invalid parameters error
-		THROW(INVALID_PARAMETERS_ERROR);
+		// Get if the value is less than the modulus
+		uint32_t borrow = 0;
+		for(size_t j = 0; j < QUADRATIC_RESIDUE_LIMBS; ++j) {
+
+			// Subtract modulus's limb and borrow from the value's limb
+			const uint64_t difference = (uint64_t)value[j] - modulus[j] - borrow;
+			borrow = (difference >> (sizeof(uint32_t) * BITS_IN_A_BYTE)) & 1;
+		}
+
+		// Get mask for if the value is odd and less than the modulus
+		const uint32_t swapMask = oddMask & -borrow;
+
+		// Negate the result if swapping values that are both congruent to three modulo four
+		negate ^= ((value[0] & modulus[0] & swapMask) >> 1) & 1;
+
+		// Go through all limbs
+		borrow = 0;
+		for(size_t j = 0; j < QUADRATIC_RESIDUE_LIMBS; ++j) {
+
+			// Swap the value's and modulus's limbs if swapping
+			const uint32_t swap = (value[j] ^ modulus[j]) & swapMask;
+			value[j] ^= swap;
+			modulus[j] ^= swap;
+
+			// Subtract modulus's limb and borrow from the value's limb if the value is odd
+			const uint64_t difference = (uint64_t)value[j] - (modulus[j] & oddMask) - borrow;
+			value[j] = difference;
+			borrow = (difference >> (sizeof(uint32_t) * BITS_IN_A_BYTE)) & 1;
+		}
+
+		// Halve the value since it's now even
+		for(size_t j = 0; j < QUADRATIC_RESIDUE_LIMBS - 1; ++j) {
+			value[j] = (value[j] >> 1) | (value[j + 1] << (sizeof(uint32_t) * BITS_IN_A_BYTE - 1));
+		}
+		value[QUADRATIC_RESIDUE_LIMBS - 1] >>= 1;
+
+		// Negate the result if the modulus is congruent to three or five modulo eight
+		negate ^= ((modulus[0] >> 1) ^ (modulus[0] >> 2)) & 1;
 	}
 
+	// Clear the value
+	explicit_bzero((uint32_t *)value, sizeof(value));
+
+	// Return if the component is quadratic residue
+	return !negate;
+}
+
+// Uncompress secp256k1 public key
+bool uncompressSecp256k1PublicKey(uint8_t *publicKey) {
+
+	// Get the public key's y squared
+	uint8_t ySquared[PUBLIC_KEY_COMPONENT_SIZE];
+	getSecp256k1YSquared(ySquared, publicKey);
+
 	// Get the square root of y squared and throw error if it fails
 	uint8_t *y = &publicKey[PUBLIC_KEY_PREFIX_SIZE + PUBLIC_KEY_COMPONENT_SIZE];
 	CX_THROW(cx_math_powm_no_throw(y, ySquared, SECP256K1_CURVE_SQUARE_ROOT_EXPONENT, sizeof(SECP256K1_CURVE_SQUARE_ROOT_EXPONENT), SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
 
+	// Get the square of the square root and throw error if it fails
+	uint8_t squareRootSquared[PUBLIC_KEY_COMPONENT_SIZE];
+	CX_THROW(cx_math_multm_no_throw(squareRootSquared, y, y, SECP256K1_CURVE_PRIME, sizeof(squareRootSquared)));
+
+	// Check if y squared doesn't have a square root
+	if(compareBigNumbers(squareRootSquared, ySquared, sizeof(ySquared))) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
 	// Check if the y component's oddness doesn't match the expected oddness
-	if((y[PUBLIC_KEY_COMPONENT_SIZE - 1] & 1) != (publicKey[0] == ODD_COMPRESSED_PUBLIC_KEY_PREFIX)) {
+	const bool hasExpectedParity = (y[PUBLIC_KEY_COMPONENT_SIZE - 1] & 1) == (publicKey[0] == ODD_COMPRESSED_PUBLIC_KEY_PREFIX);
+	if(!hasExpectedParity) {
 
 		// Negate the y component and throw error if it fails
 		CX_THROW(cx_math_subm_no_throw(y, SECP256K1_CURVE_PRIME, y, SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
@@ -1372,6 +1570,9 @@ void uncompressSecp256k1PublicKey(uint8_t *publicKey) {
 
 	// Set public key's prefix to be uncompressed
 	publicKey[0] = UNCOMPRESSED_PUBLIC_KEY_PREFIX;
+
+	// Return if the y component is quadratic residue since the square root exponent always results in a quadratic residue that's only kept when it has the expected parity and its negation never is
+	return hasExpectedParity;
 }
 
 // Get Ed25519 public key
@@ -1493,6 +1694,9 @@ void calculateBulletproofComponents(volatile uint8_t *tauX, volatile uint8_t *tO
 				THROW(INTERNAL_ERROR_ERROR);
 			}
 
+			// Start bits bulletproof performance counter
+			START_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE, BITS_BULLETPROOF_PERFORMANCE_PASS);
+
 			// Go through all bits to prove
 			for(uint_fast8_t i = 0; i < BITS_TO_PROVE; ++i) {
 
@@ -1592,6 +1796,9 @@ void calculateBulletproofComponents(volatile uint8_t *tauX, volatile uint8_t *tO
 			os_io_seph_recv_and_process(0);
 #endif
 
+			// Stop bits bulletproof performance counter
+			STOP_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE);
+
 			// Update running commitment with the alpha generator and rho generator
 			bulletproofUpdateCommitment(runningCommitment, (uint8_t *)&alphaGenerator[PUBLIC_KEY_PREFIX_SIZE], (uint8_t *)&rhoGenerator[PUBLIC_KEY_PREFIX_SIZE]);
 
@@ -1619,6 +1826,9 @@ void calculateBulletproofComponents(volatile uint8_t *tauX, volatile uint8_t *tO
 			// Get z from running commitment
 			memcpy((uint8_t *)z, (uint8_t *)runningCommitment, sizeof(z));
 
+			// Start LR generator bulletproof performance counter
+			START_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE, LR_GENERATOR_BULLETPROOF_PERFORMANCE_PASS);
+
 			// Create t0, t1, and t2 with an LR generator
 			uint8_t *t0 = (uint8_t *)rho;
 			explicit_bzero(t0, SCALAR_SIZE);
@@ -1669,6 +1879,12 @@ void calculateBulletproofComponents(volatile uint8_t *tauX, volatile uint8_t *tO
 			os_io_seph_recv_and_process(0);
 #endif
 
+			// Stop LR generator bulletproof performance counter
+			STOP_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE);
+
+			// Start tau bulletproof performance counter
+			START_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE, TAU_BULLETPROOF_PERFORMANCE_PASS);
+
 			// Create tau1 and tau2 from the private nonce
 			uint8_t *tau1 = (uint8_t *)alpha;
 			uint8_t *tau2 = (uint8_t *)rho;
@@ -1801,11 +2017,17 @@ void calculateBulletproofComponents(volatile uint8_t *tauX, volatile uint8_t *tO
 
 			// Add the result to get tau x and throw error if it fails
 			CX_THROW(cx_math_addm_no_throw((uint8_t *)tauX, tempOne, tempTwo, SECP256K1_CURVE_ORDER, SCALAR_SIZE));
+
+			// Stop tau bulletproof performance counter
+			STOP_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE);
 		}
 
 		// Finally
 		FINALLY {
 
+			// Stop the bulletproof pass performance counter that an error left running
+			STOP_RUNNING_PERFORMANCE_COUNTER(BULLETPROOF_PERFORMANCE_STAGE);
+
 			// Clear t1 and t2
 			explicit_bzero((uint8_t *)t1, sizeof(t1));
 			explicit_bzero((uint8_t *)t2, sizeof(t2));
@@ -1984,6 +2206,99 @@ void deriveChildKey(volatile cx_ecfp_private_key_t *privateKey, volatile uint8_t
 	END_TRY;
 }
 
+// Get blinding factor from child key
+void getBlindingFactorFromChildKey(volatile uint8_t *blindingFactor, const cx_ecfp_private_key_t *childPrivateKey, const uint64_t value, const enum SwitchType switchType) {
+
+	// Initialize hash
+	volatile cx_sha256_t hash;
+
+	// Initialize publicKeyGenerator
+	volatile uint8_t publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE + sizeof(GENERATOR_J)] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX};
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Check switch type
+			switch(switchType) {
+
+				// No switch type
+				case NO_SWITCH_TYPE:
+
+					// Set blinding factor to the child's private key
+					memcpy((uint8_t *)blindingFactor, (uint8_t *)childPrivateKey->d, childPrivateKey->d_len);
+
+					// Break
+					break;
+
+				// Regular switch type
+				case REGULAR_SWITCH_TYPE: {
+
+					// Get commitment from value and child's private key
+					uint8_t *commitment = (uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE];
+					commitValue(commitment, value, (uint8_t *)childPrivateKey->d, true);
+
+					// Add commitment to the hash and throw error if it fails
+					cx_sha256_init((cx_sha256_t *)&hash);
+					CX_THROW(cx_hash_no_throw((cx_hash_t *)&hash, 0, commitment, COMMITMENT_SIZE, NULL, 0));
+
+					// Get product of the generator public key and the child's private key and throw error if it fails
+					memcpy((uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE], GENERATOR_J, sizeof(GENERATOR_J));
+					CX_THROW(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, (uint8_t *)publicKeyGenerator, (uint8_t *)childPrivateKey->d, BLINDING_FACTOR_SIZE));
+
+					// Check if the result has an x component of zero
+					if(isZeroArraySecure((uint8_t *)&publicKeyGenerator[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
+
+						// Throw internal error error
+						THROW(INTERNAL_ERROR_ERROR);
+					}
+
+					// Compress the result
+					publicKeyGenerator[0] = (publicKeyGenerator[sizeof(publicKeyGenerator) - 1] & 1) ? ODD_COMPRESSED_PUBLIC_KEY_PREFIX : EVEN_COMPRESSED_PUBLIC_KEY_PREFIX;
+
+					// Add result to the hash and get the blinding factor and throw error if it fails
+					CX_THROW(cx_hash_no_throw((cx_hash_t *)&hash, CX_LAST, (uint8_t *)publicKeyGenerator, COMPRESSED_PUBLIC_KEY_SIZE, (uint8_t *)blindingFactor, BLINDING_FACTOR_SIZE));
+
+					// Check if the blinding factor overflows
+					if(compareBigNumbers((uint8_t *)blindingFactor, SECP256K1_CURVE_ORDER, BLINDING_FACTOR_SIZE) >= 0) {
+
+						// Throw internal error error
+						THROW(INTERNAL_ERROR_ERROR);
+					}
+
+					// Add the child's private key to the blinding factor and throw error if it fails
+					CX_THROW(cx_math_addm_no_throw((uint8_t *)blindingFactor, (uint8_t *)blindingFactor, (uint8_t *)childPrivateKey->d, SECP256K1_CURVE_ORDER, BLINDING_FACTOR_SIZE));
+
+					// Check if blinding factor isn't a valid secret key
+					if(!isValidSecp256k1PrivateKey((uint8_t *)blindingFactor, BLINDING_FACTOR_SIZE)) {
+
+						// Throw internal error error
+						THROW(INTERNAL_ERROR_ERROR);
+					}
+
+					// Break
+					break;
+				}
+			}
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the public key generator
+			explicit_bzero((uint8_t *)publicKeyGenerator, sizeof(publicKeyGenerator));
+
+			// Clear the hash
+			explicit_bzero((cx_sha256_t *)&hash, sizeof(hash));
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
 // Bulletproof update commitment
 void bulletproofUpdateCommitment(volatile uint8_t *commitment, const uint8_t *leftPart, const uint8_t *rightPart) {
 
@@ -2254,46 +2569,6 @@ void useLrGenerator(volatile uint8_t *t0, volatile uint8_t *t1, volatile uint8_t
 	END_TRY;
 }
 
-// Is quadratic residue
-bool isQuadraticResidue(const uint8_t *component) {
-
-	// Initialize square root squared
-	volatile uint8_t squareRootSquared[PUBLIC_KEY_COMPONENT_SIZE];
-
-	// Initialize result
-	volatile bool result;
-
-	// Begin try
-	BEGIN_TRY {
-
-		// Try
-		TRY {
-
-			// Get the square root of the component squared and throw error if it fails
-			CX_THROW(cx_math_powm_no_throw((uint8_t *)squareRootSquared, component, SECP256K1_CURVE_SQUARE_ROOT_EXPONENT, sizeof(SECP256K1_CURVE_SQUARE_ROOT_EXPONENT), SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
-
-			const uint8_t two[] = {2};
-			CX_THROW(cx_math_powm_no_throw((uint8_t *)squareRootSquared, (uint8_t *)squareRootSquared, two, sizeof(two), SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
-
-			// Set result to if the component is quadratic residue
-			result = !compareBigNumbers(component, (uint8_t *)squareRootSquared, PUBLIC_KEY_COMPONENT_SIZE);
-		}
-
-		// Finally
-		FINALLY {
-
-			// Clear square root squared
-			explicit_bzero((uint8_t *)squareRootSquared, sizeof(squareRootSquared));
-		}
-	}
-
-	// End try
-	END_TRY;
-
-	// Return result
-	return result;
-}
-
 // Generator double point scalar multiply
 void generatorDoublePointScalarMultiply(uint8_t *result, const size_t index, const uint8_t *scalarOne, const uint8_t *scalarTwo) {
 
@@ -2394,6 +2669,29 @@ end:
 	}
 }
 
+// Get secp256k1 y squared
+void getSecp256k1YSquared(uint8_t *ySquared, const uint8_t *publicKey) {
+
+	// Get public key's x component
+	const uint8_t *x = &publicKey[PUBLIC_KEY_PREFIX_SIZE];
+
+	// Check if public key's prefix is invalid or its x component overflows
+	if((publicKey[0] != EVEN_COMPRESSED_PUBLIC_KEY_PREFIX && publicKey[0] != ODD_COMPRESSED_PUBLIC_KEY_PREFIX) || compareBigNumbers(x, SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE) >= 0) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Get y squared as x cubed plus seven and throw error if it fails
+	const uint8_t three = 3;
+	CX_THROW(cx_math_powm_no_throw(ySquared, x, &three, sizeof(three), SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
+
+	const uint8_t seven[SCALAR_SIZE] = {
+		[SCALAR_SIZE - 1] = 7,
+	};
+	CX_THROW(cx_math_addm_no_throw(ySquared, ySquared, seven, SECP256K1_CURVE_PRIME, PUBLIC_KEY_COMPONENT_SIZE));
+}
+
 // Compare big numbers
 int compareBigNumbers(const uint8_t *firstValue, const uint8_t *secondValue, const size_t valueLength) {
 
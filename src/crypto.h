@@ -36,6 +36,9 @@
 // Commitment size
 #define COMMITMENT_SIZE 33
 
+// Chain code size
+#define CHAIN_CODE_SIZE 32
+
 // Identifier maximum depth
 #define IDENTIFIER_MAXIMUM_DEPTH 4
 
@@ -89,6 +92,19 @@ enum SwitchType {
 };
 
 
+// Structures
+
+// Session cipher
+struct SessionCipher {
+
+	// Key
+	cx_aes_key_t key;
+
+	// Chaining value
+	uint8_t chainingValue[CX_AES_BLOCK_SIZE];
+};
+
+
 // Function prototypes
 
 // Get private key and chain code
@@ -97,9 +113,18 @@ void getPrivateKeyAndChainCode(volatile cx_ecfp_private_key_t *privateKey, volat
 // Get public key from private key
 void getPublicKeyFromPrivateKey(volatile uint8_t *publicKey, const cx_ecfp_private_key_t *privateKey);
 
+// Get root public key
+void getRootPublicKey(volatile uint8_t *rootPublicKey, const uint32_t account);
+
 // Derive blinding factor
 void deriveBlindingFactor(volatile uint8_t *blindingFactor, const uint32_t account, const uint64_t value, const uint32_t *path, const size_t pathLength, const enum SwitchType switchType);
 
+// Derive identifier parent key
+void deriveIdentifierParentKey(volatile cx_ecfp_private_key_t *parentPrivateKey, volatile uint8_t *parentChainCode, const uint32_t account, const uint32_t *path, const size_t pathLength);
+
+// Derive blinding factor from parent key
+void deriveBlindingFactorFromParentKey(volatile uint8_t *blindingFactor, const cx_ecfp_private_key_t *parentPrivateKey, const uint8_t *parentChainCode, const uint32_t index, const uint64_t value, const enum SwitchType switchType);
+
 // Commit value
 void commitValue(volatile uint8_t *commitment, const uint64_t value, const uint8_t *blindingFactor, const bool compress);
 
@@ -119,7 +144,7 @@ void updateBlindingFactorSum(uint8_t *blindingFactorSum, const uint8_t *blinding
 void createSingleSignerNonces(uint8_t *secretNonce, uint8_t *publicNonce);
 
 // Create single-signer signature
-void createSingleSignerSignature(volatile uint8_t *signature, const uint8_t *message, const uint8_t *blindingFactor, const uint8_t *secretNonce, const uint8_t *publicNonce, const uint8_t *publicKey);
+void createSingleSignerSignature(volatile uint8_t *signature, const uint8_t *message, const uint8_t *blindingFactor, const uint8_t *secretNonce, const uint8_t *signerPublicNonce, const uint8_t *publicNonce, const uint8_t *publicKey);
 
 // Get encrypted data length
 size_t getEncryptedDataLength(const size_t dataLength);
@@ -130,6 +155,15 @@ void encryptData(volatile uint8_t *result, const uint8_t *data, const size_t dat
 // Decrypt data
 size_t decryptData(volatile uint8_t *result, const uint8_t *data, const size_t dataLength, const uint8_t *key, const size_t keyLength);
 
+// Initialize session cipher
+void initializeSessionCipher(volatile struct SessionCipher *sessionCipher, const uint8_t *key, const size_t keyLength);
+
+// Get session cipher encrypted data length
+size_t getSessionCipherEncryptedDataLength(const size_t dataLength, const bool isLastData);
+
+// Encrypt session cipher data
+void encryptSessionCipherData(volatile struct SessionCipher *sessionCipher, volatile uint8_t *result, const uint8_t *data, const size_t dataLength, const bool isLastData);
+
 // Get X25519 private key from Ed25519 private key
 void getX25519PrivateKeyFromEd25519PrivateKey(volatile cx_ecfp_private_key_t *x25519PrivateKey, const cx_ecfp_private_key_t *ed25519PrivateKey);
 
@@ -166,8 +200,11 @@ bool isValidSecp256k1PrivateKey(const uint8_t *privateKey, const size_t length);
 // Is valid secp256k1 public key
 bool isValidSecp256k1PublicKey(const uint8_t *publicKey, const size_t length);
 
+// Is quadratic residue
+bool isQuadraticResidue(const uint8_t *component);
+
 // Uncompress secp256k1 public key
-void uncompressSecp256k1PublicKey(uint8_t *publicKey);
+bool uncompressSecp256k1PublicKey(uint8_t *publicKey);
 
 // Get Ed25519 public key
 void getEd25519PublicKey(uint8_t *ed25519PublicKey, const uint32_t account, const uint32_t index);
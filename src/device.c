@@ -2,6 +2,7 @@
 #include <os_io_seproxyhal.h>
 #include <ux.h>
 #include "device.h"
+#include "shared_secret_cache.h"
 
 
 // Global variables
@@ -146,6 +147,9 @@ unsigned char io_event(__attribute__((unused)) const unsigned char channel) {
 		// Ticker event
 		case SEPROXYHAL_TAG_TICKER_EVENT:
 
+			// Tick shared secret cache
+			tickSharedSecretCache();
+
 			// UX ticker event
 			UX_TICKER_EVENT(G_io_seproxyhal_spi_buffer, {});
 
@@ -10,4 +10,33 @@
 #include <os_apdu.h>
 
 
+// Definitions
+
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Session local
+	#define SESSION_LOCAL _Thread_local
+
+	// IO APDU buffer
+	#define G_io_apdu_buffer (*getSessionIoApduBuffer())
+
+// Otherwise
+#else
+
+	// Session local
+	#define SESSION_LOCAL
+#endif
+
+
+// Function prototypes
+
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Get session IO APDU buffer
+	unsigned char (*getSessionIoApduBuffer(void))[IO_APDU_BUFFER_SIZE];
+#endif
+
+
 #endif
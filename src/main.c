@@ -6,6 +6,7 @@
 #include "common.h"
 #include "menus.h"
 #include "process_requests.h"
+#include "root_public_key_cache.h"
 #include "state.h"
 #include "storage.h"
 
@@ -28,6 +29,9 @@ __attribute__((section(".boot"))) int main() {
 		// Reset state
 		resetState();
 
+		// Reset root public key cache
+		resetRootPublicKeyCache();
+
 		// Initialize UX
 		UX_INIT();
 
@@ -57,67 +57,67 @@
 // Global variables
 
 // Time line buffer
-char timeLineBuffer[TIME_LINE_BUFFER_SIZE];
+SESSION_LOCAL char timeLineBuffer[TIME_LINE_BUFFER_SIZE];
 
 // Progress bar message line buffer
-char progressBarMessageLineBuffer[PROGRESS_BAR_MESSAGE_LINE_BUFFER_SIZE];
+SESSION_LOCAL char progressBarMessageLineBuffer[PROGRESS_BAR_MESSAGE_LINE_BUFFER_SIZE];
 
 // Public key line buffer
-volatile char publicKeyLineBuffer[PUBLIC_KEY_LINE_BUFFER_SIZE];
+SESSION_LOCAL volatile char publicKeyLineBuffer[PUBLIC_KEY_LINE_BUFFER_SIZE];
 
 // Address line buffer
-char addressLineBuffer[ADDRESS_LINE_BUFFER_SIZE];
+SESSION_LOCAL char addressLineBuffer[ADDRESS_LINE_BUFFER_SIZE];
 
 // Verify address line buffer
-char verifyAddressLineBuffer[VERIFY_ADDRESS_LINE_BUFFER_SIZE];
+SESSION_LOCAL char verifyAddressLineBuffer[VERIFY_ADDRESS_LINE_BUFFER_SIZE];
 
 // Approve transaction line buffer
-char approveTransactionLineBuffer[APPROVE_TRANSACTION_LINE_BUFFER_SIZE];
+SESSION_LOCAL char approveTransactionLineBuffer[APPROVE_TRANSACTION_LINE_BUFFER_SIZE];
 
 // Sign challenge line buffer
-char signChallengeLineBuffer[SIGN_CHALLENGE_LINE_BUFFER_SIZE];
+SESSION_LOCAL char signChallengeLineBuffer[SIGN_CHALLENGE_LINE_BUFFER_SIZE];
 
 // Amount line buffer
-char amountLineBuffer[AMOUNT_LINE_BUFFER_SIZE];
+SESSION_LOCAL char amountLineBuffer[AMOUNT_LINE_BUFFER_SIZE];
 
 // Address type line buffer
-char addressTypeLineBuffer[ADDRESS_TYPE_LINE_BUFFER_SIZE];
+SESSION_LOCAL char addressTypeLineBuffer[ADDRESS_TYPE_LINE_BUFFER_SIZE];
 
 // Fee line buffer
-char feeLineBuffer[FEE_LINE_BUFFER_SIZE];
+SESSION_LOCAL char feeLineBuffer[FEE_LINE_BUFFER_SIZE];
 
 // Kernel features line buffer
-char kernelFeaturesLineBuffer[KERNEL_FEATURES_LINE_BUFFER_SIZE];
+SESSION_LOCAL char kernelFeaturesLineBuffer[KERNEL_FEATURES_LINE_BUFFER_SIZE];
 
 // Kernel features details title line buffer
-char kernelFeaturesDetailsTitleLineBuffer[KERNEL_FEATURES_DETAILS_TITLE_LINE_BUFFER_SIZE];
+SESSION_LOCAL char kernelFeaturesDetailsTitleLineBuffer[KERNEL_FEATURES_DETAILS_TITLE_LINE_BUFFER_SIZE];
 
 // Kernel features details text line buffer
-char kernelFeaturesDetailsTextLineBuffer[KERNEL_FEATURES_DETAILS_TEXT_LINE_BUFFER_SIZE];
+SESSION_LOCAL char kernelFeaturesDetailsTextLineBuffer[KERNEL_FEATURES_DETAILS_TEXT_LINE_BUFFER_SIZE];
 
 // Account index line buffer
-char accountIndexLineBuffer[ACCOUNT_INDEX_LINE_BUFFER_SIZE];
+SESSION_LOCAL char accountIndexLineBuffer[ACCOUNT_INDEX_LINE_BUFFER_SIZE];
 
 // Check if has NBGL
 #ifdef HAVE_NBGL
 
 // Succeeded line buffer
-char succeededLineBuffer[SUCCEEDED_LINE_BUFFER_SIZE];
+SESSION_LOCAL char succeededLineBuffer[SUCCEEDED_LINE_BUFFER_SIZE];
 
 // Failed line buffer
-char failedLineBuffer[FAILED_LINE_BUFFER_SIZE];
+SESSION_LOCAL char failedLineBuffer[FAILED_LINE_BUFFER_SIZE];
 
 // Canceled line buffer
-char canceledLineBuffer[CANCELED_LINE_BUFFER_SIZE];
+SESSION_LOCAL char canceledLineBuffer[CANCELED_LINE_BUFFER_SIZE];
 
 // Cancel prompt line buffer
-char cancelPromptLineBuffer[CANCEL_PROMPT_LINE_BUFFER_SIZE];
+SESSION_LOCAL char cancelPromptLineBuffer[CANCEL_PROMPT_LINE_BUFFER_SIZE];
 
 // Approve button line buffer
-char approveButtonLineBuffer[APPROVE_BUTTON_LINE_BUFFER_SIZE];
+SESSION_LOCAL char approveButtonLineBuffer[APPROVE_BUTTON_LINE_BUFFER_SIZE];
 
 // Warning line buffer
-char warningLineBuffer[WARNING_LINE_BUFFER];
+SESSION_LOCAL char warningLineBuffer[WARNING_LINE_BUFFER];
 
 // Export root public key menu tag value pairs
 static nbgl_layoutTagValue_t exportRootPublicKeyMenuTagValuePairs[2];
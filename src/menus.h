@@ -129,67 +129,67 @@ enum Menu {
 // Global variables
 
 // Time line buffer
-extern char timeLineBuffer[TIME_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char timeLineBuffer[TIME_LINE_BUFFER_SIZE];
 
 // Progress bar message line buffer
-extern char progressBarMessageLineBuffer[PROGRESS_BAR_MESSAGE_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char progressBarMessageLineBuffer[PROGRESS_BAR_MESSAGE_LINE_BUFFER_SIZE];
 
 // Public key line buffer
-extern volatile char publicKeyLineBuffer[PUBLIC_KEY_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL volatile char publicKeyLineBuffer[PUBLIC_KEY_LINE_BUFFER_SIZE];
 
 // Address line buffer
-extern char addressLineBuffer[ADDRESS_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char addressLineBuffer[ADDRESS_LINE_BUFFER_SIZE];
 
 // Verify address line buffer
-extern char verifyAddressLineBuffer[VERIFY_ADDRESS_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char verifyAddressLineBuffer[VERIFY_ADDRESS_LINE_BUFFER_SIZE];
 
 // Approve transaction line buffer
-extern char approveTransactionLineBuffer[APPROVE_TRANSACTION_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char approveTransactionLineBuffer[APPROVE_TRANSACTION_LINE_BUFFER_SIZE];
 
 // Sign challenge line buffer
-extern char signChallengeLineBuffer[SIGN_CHALLENGE_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char signChallengeLineBuffer[SIGN_CHALLENGE_LINE_BUFFER_SIZE];
 
 // Amount line buffer
-extern char amountLineBuffer[AMOUNT_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char amountLineBuffer[AMOUNT_LINE_BUFFER_SIZE];
 
 // Address type line buffer
-extern char addressTypeLineBuffer[ADDRESS_TYPE_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char addressTypeLineBuffer[ADDRESS_TYPE_LINE_BUFFER_SIZE];
 
 // Fee line buffer
-extern char feeLineBuffer[FEE_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char feeLineBuffer[FEE_LINE_BUFFER_SIZE];
 
 // Kernel features line buffer
-extern char kernelFeaturesLineBuffer[KERNEL_FEATURES_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char kernelFeaturesLineBuffer[KERNEL_FEATURES_LINE_BUFFER_SIZE];
 
 // Kernel features details title line buffer
-extern char kernelFeaturesDetailsTitleLineBuffer[KERNEL_FEATURES_DETAILS_TITLE_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char kernelFeaturesDetailsTitleLineBuffer[KERNEL_FEATURES_DETAILS_TITLE_LINE_BUFFER_SIZE];
 
 // Kernel features details text line buffer
-extern char kernelFeaturesDetailsTextLineBuffer[KERNEL_FEATURES_DETAILS_TEXT_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char kernelFeaturesDetailsTextLineBuffer[KERNEL_FEATURES_DETAILS_TEXT_LINE_BUFFER_SIZE];
 
 // Account index line buffer
-extern char accountIndexLineBuffer[ACCOUNT_INDEX_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char accountIndexLineBuffer[ACCOUNT_INDEX_LINE_BUFFER_SIZE];
 
 // Check if has NBGL
 #ifdef HAVE_NBGL
 
 // Succeeded line buffer
-extern char succeededLineBuffer[SUCCEEDED_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char succeededLineBuffer[SUCCEEDED_LINE_BUFFER_SIZE];
 
 // Failed line buffer
-extern char failedLineBuffer[FAILED_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char failedLineBuffer[FAILED_LINE_BUFFER_SIZE];
 
 // Canceled line buffer
-extern char canceledLineBuffer[CANCELED_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char canceledLineBuffer[CANCELED_LINE_BUFFER_SIZE];
 
 // Cancel prompt line buffer
-extern char cancelPromptLineBuffer[CANCEL_PROMPT_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char cancelPromptLineBuffer[CANCEL_PROMPT_LINE_BUFFER_SIZE];
 
 // Approve button line buffer
-extern char approveButtonLineBuffer[APPROVE_BUTTON_LINE_BUFFER_SIZE];
+extern SESSION_LOCAL char approveButtonLineBuffer[APPROVE_BUTTON_LINE_BUFFER_SIZE];
 
 // Warning line buffer
-extern char warningLineBuffer[WARNING_LINE_BUFFER];
+extern SESSION_LOCAL char warningLineBuffer[WARNING_LINE_BUFFER];
 
 #endif
 
@@ -5,6 +5,7 @@
 #include "currency.h"
 #include "crypto.h"
 #include "mqs.h"
+#include "shared_secret_cache.h"
 
 
 // Definitions
@@ -18,13 +19,8 @@
 // Create MQS shared private key
 void createMqsSharedPrivateKey(volatile uint8_t *sharedPrivateKey, const uint32_t account, const uint32_t index, const char *address, const uint8_t *salt) {
 
-	// Check if getting public key from address failed
-	cx_ecfp_public_key_t publicKey;
-	if(!getPublicKeyFromMqsAddress(&publicKey, address, MQS_ADDRESS_SIZE)) {
-
-		// Throw invalid parameters error
-		THROW(INVALID_PARAMETERS_ERROR);
-	}
+	// Initialize shared point
+	volatile uint8_t sharedPoint[PUBLIC_KEY_COMPONENT_SIZE];
 
 	// Initialize private key
 	volatile cx_ecfp_private_key_t privateKey;
@@ -35,20 +31,41 @@ void createMqsSharedPrivateKey(volatile uint8_t *sharedPrivateKey, const uint32_
 		// Try
 		TRY {
 
-			// Get private key
-			getAddressPrivateKey(&privateKey, account, index, CX_CURVE_SECP256K1);
+			// Check if the shared point isn't cached
+			if(!getCachedSharedSecret(sharedPoint, account, index, address, MQS_ADDRESS_SIZE)) {
 
-			// Check if the product of the public key by the private key has an x component of zero and throw error if it fails
-			CX_THROW(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, publicKey.W, (uint8_t *)privateKey.d, privateKey.d_len));
+				// Check if getting public key from address failed
+				cx_ecfp_public_key_t publicKey;
+				if(!getPublicKeyFromMqsAddress(&publicKey, address, MQS_ADDRESS_SIZE)) {
 
-			if(isZeroArraySecure(&publicKey.W[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
+					// Throw invalid parameters error
+					THROW(INVALID_PARAMETERS_ERROR);
+				}
 
-				// Throw internal error error
-				THROW(INTERNAL_ERROR_ERROR);
+				// Get private key
+				getAddressPrivateKey(&privateKey, account, index, CX_CURVE_SECP256K1);
+
+				// Check if the product of the public key by the private key has an x component of zero and throw error if it fails
+				CX_THROW(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, publicKey.W, (uint8_t *)privateKey.d, privateKey.d_len));
+
+				if(isZeroArraySecure(&publicKey.W[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE)) {
+
+					// Throw internal error error
+					THROW(INTERNAL_ERROR_ERROR);
+				}
+
+				// Set shared point to the tweaked public key's x component
+				memcpy((uint8_t *)sharedPoint, &publicKey.W[PUBLIC_KEY_PREFIX_SIZE], sizeof(sharedPoint));
+
+				// Clear the tweaked public key
+				explicit_bzero(&publicKey, sizeof(publicKey));
+
+				// Cache the shared point
+				cacheSharedSecret((uint8_t *)sharedPoint, account, index, address, MQS_ADDRESS_SIZE);
 			}
 
-			// Get shared private key from the tweaked public key and salt
-			cx_pbkdf2_sha512(&publicKey.W[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE, (uint8_t *)salt, MQS_SHARED_PRIVATE_KEY_SALT_SIZE, MQS_SHARED_PRIVATE_KEY_NUMBER_OF_ITERATIONS, (uint8_t *)sharedPrivateKey, MQS_SHARED_PRIVATE_KEY_SIZE);
+			// Get shared private key from the shared point and salt
+			cx_pbkdf2_sha512((uint8_t *)sharedPoint, sizeof(sharedPoint), (uint8_t *)salt, MQS_SHARED_PRIVATE_KEY_SALT_SIZE, MQS_SHARED_PRIVATE_KEY_NUMBER_OF_ITERATIONS, (uint8_t *)sharedPrivateKey, MQS_SHARED_PRIVATE_KEY_SIZE);
 
 			// Check if shared private key is zero
 			if(isZeroArraySecure((uint8_t *)sharedPrivateKey, MQS_SHARED_PRIVATE_KEY_SIZE)) {
@@ -61,6 +78,9 @@ void createMqsSharedPrivateKey(volatile uint8_t *sharedPrivateKey, const uint32_
 		// Finally
 		FINALLY {
 
+			// Clear the shared point
+			explicit_bzero((uint8_t *)sharedPoint, sizeof(sharedPoint));
+
 			// Clear the private key
 			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
 		}
@@ -80,19 +100,9 @@ bool getPublicKeyFromMqsAddress(cx_ecfp_public_key_t *publicKey, const char *mqs
 		return false;
 	}
 
-	// Get decoded MQS address length
-	const size_t decodedMqsAddressLength = getBase58DecodedLengthWithChecksum(mqsAddress, length);
-
-	// Check if decoded MQS address length is invalid
-	if(decodedMqsAddressLength != sizeof((uint8_t[])CURRENCY_MQS_VERSION) + COMPRESSED_PUBLIC_KEY_SIZE + BASE58_CHECKSUM_SIZE) {
-
-		// Return false
-		return false;
-	}
-
-	// Check if decoding MQS address failed
+	// Check if decoding MQS address failed or its length is invalid
 	uint8_t decodedMqsAddress[sizeof((uint8_t[])CURRENCY_MQS_VERSION) + COMPRESSED_PUBLIC_KEY_SIZE + BASE58_CHECKSUM_SIZE];
-	if(!base58DecodeWithChecksum(decodedMqsAddress, mqsAddress, length)) {
+	if(base58DecodeWithChecksum(decodedMqsAddress, sizeof(decodedMqsAddress), mqsAddress, length) != sizeof(decodedMqsAddress)) {
 
 		// Return false
 		return false;
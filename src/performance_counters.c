@@ -0,0 +1,111 @@
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+// Header files
+#include <string.h>
+#include <time.h>
+#include "common.h"
+#include "performance_counters.h"
+
+
+// Global variables
+
+// Performance counters
+SESSION_LOCAL struct PerformanceCounters performanceCounters;
+
+
+// Function prototypes
+
+// Get performance counter ticks
+static uint32_t getPerformanceCounterTicks(void);
+
+
+// Supporting function implementation
+
+// Reset performance counters
+void resetPerformanceCounters(void) {
+
+	// Clear the performance counters' entries
+	explicit_bzero(performanceCounters.entries, sizeof(performanceCounters.entries));
+
+	// Reset the performance counters' number of recorded entries without resetting their running stages since those stages will still be stopped
+	performanceCounters.numberOfRecordedEntries = 0;
+}
+
+// Record performance counter
+void recordPerformanceCounter(const uint8_t stage, const uint8_t argument) {
+
+	// Get the entry after the most recently recorded entry which overwrites the oldest entry once the entries are full
+	struct PerformanceCounterEntry *entry = &performanceCounters.entries[performanceCounters.numberOfRecordedEntries % NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES];
+
+	// Check if stopping a stage and a stage is running
+	if((stage & PERFORMANCE_COUNTER_STOP_FLAG) && performanceCounters.numberOfRunningStages) {
+
+		// Decrement number of running stages
+		--performanceCounters.numberOfRunningStages;
+	}
+
+	// Set entry's ticks, stage, argument, and depth which is the same for a start and its stop
+	entry->ticks = getPerformanceCounterTicks();
+	entry->stage = stage;
+	entry->argument = argument;
+	entry->depth = performanceCounters.numberOfRunningStages;
+
+	// Increment number of recorded entries
+	++performanceCounters.numberOfRecordedEntries;
+
+	// Check if starting a stage and its depth can be represented
+	if(!(stage & PERFORMANCE_COUNTER_STOP_FLAG) && performanceCounters.numberOfRunningStages != UINT8_MAX) {
+
+		// Check if the stage can be stored
+		if(performanceCounters.numberOfRunningStages < MAXIMUM_NUMBER_OF_RUNNING_PERFORMANCE_COUNTERS) {
+
+			// Store the stage
+			performanceCounters.runningStages[performanceCounters.numberOfRunningStages] = stage;
+		}
+
+		// Increment number of running stages
+		++performanceCounters.numberOfRunningStages;
+	}
+}
+
+// Stop running performance counter
+void stopRunningPerformanceCounter(const uint8_t stage) {
+
+	// Check if the most recently started stage that's still running is the stage
+	if(performanceCounters.numberOfRunningStages && performanceCounters.numberOfRunningStages <= MAXIMUM_NUMBER_OF_RUNNING_PERFORMANCE_COUNTERS && performanceCounters.runningStages[performanceCounters.numberOfRunningStages - 1] == stage) {
+
+		// Stop the stage
+		recordPerformanceCounter(stage | PERFORMANCE_COUNTER_STOP_FLAG, 0);
+	}
+}
+
+// Get number of stored performance counter entries
+uint16_t getNumberOfStoredPerformanceCounterEntries(void) {
+
+	// Return number of stored entries
+	return MIN(performanceCounters.numberOfRecordedEntries, NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES);
+}
+
+// Get stored performance counter entry
+const struct PerformanceCounterEntry *getStoredPerformanceCounterEntry(const uint16_t index) {
+
+	// Get index of the oldest stored entry
+	const uint32_t oldestIndex = (performanceCounters.numberOfRecordedEntries > NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES) ? performanceCounters.numberOfRecordedEntries % NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES : 0;
+
+	// Return stored entry at the index starting from the oldest stored entry
+	return &performanceCounters.entries[(oldestIndex + index) % NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES];
+}
+
+// Get performance counter ticks
+uint32_t getPerformanceCounterTicks(void) {
+
+	// Get current monotonic time
+	struct timespec currentTime;
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+
+	// Return current time in microseconds
+	return currentTime.tv_sec * PERFORMANCE_COUNTER_TICKS_PER_SECOND + currentTime.tv_nsec / (1000000000 / PERFORMANCE_COUNTER_TICKS_PER_SECOND);
+}
+
+#endif
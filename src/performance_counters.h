@@ -0,0 +1,184 @@
+// Header guard
+#ifndef PERFORMANCE_COUNTERS_H
+#define PERFORMANCE_COUNTERS_H
+
+
+// Header files
+#include <stdint.h>
+
+
+// Definitions
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+	// Performance counter stop flag
+	#define PERFORMANCE_COUNTER_STOP_FLAG 0x80
+
+	// Check if not fuzzing since devices and Speculos only count time in ticker events that aren't serviced while requests are processed
+	#ifndef FUZZING
+
+		// Cause error
+		#error "Performance counters are only supported by host builds"
+	#endif
+
+	// Performance counter ticks per second (microseconds)
+	#define PERFORMANCE_COUNTER_TICKS_PER_SECOND 1000000
+
+	// Number of performance counter entries
+	#define NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES 128
+
+	// Maximum number of running performance counters
+	#define MAXIMUM_NUMBER_OF_RUNNING_PERFORMANCE_COUNTERS 8
+
+	// Start performance counter
+	#define START_PERFORMANCE_COUNTER(stage, argument) recordPerformanceCounter((stage), (argument))
+
+	// Stop performance counter
+	#define STOP_PERFORMANCE_COUNTER(stage) recordPerformanceCounter((stage) | PERFORMANCE_COUNTER_STOP_FLAG, 0)
+
+	// Stop running performance counter
+	#define STOP_RUNNING_PERFORMANCE_COUNTER(stage) stopRunningPerformanceCounter(stage)
+
+	// Start performance counter with cleanup which begins a try that its stop ends so the stage is stopped even if an error is thrown
+	#define START_PERFORMANCE_COUNTER_WITH_CLEANUP(stage, argument) START_PERFORMANCE_COUNTER((stage), (argument)); BEGIN_TRY { TRY {
+
+	// Stop performance counter with cleanup
+	#define STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(stage) } FINALLY { STOP_PERFORMANCE_COUNTER(stage); } } END_TRY
+
+// Otherwise
+#else
+
+	// Start performance counter
+	#define START_PERFORMANCE_COUNTER(stage, argument) ((void)0)
+
+	// Stop performance counter
+	#define STOP_PERFORMANCE_COUNTER(stage) ((void)0)
+
+	// Stop running performance counter
+	#define STOP_RUNNING_PERFORMANCE_COUNTER(stage) ((void)0)
+
+	// Start performance counter with cleanup
+	#define START_PERFORMANCE_COUNTER_WITH_CLEANUP(stage, argument) ((void)0)
+
+	// Stop performance counter with cleanup
+	#define STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(stage) ((void)0)
+#endif
+
+
+// Constants
+
+// Performance stage
+enum PerformanceStage {
+
+	// Process request performance stage
+	PROCESS_REQUEST_PERFORMANCE_STAGE,
+
+	// Command performance stage
+	COMMAND_PERFORMANCE_STAGE,
+
+	// Derivation performance stage
+	DERIVATION_PERFORMANCE_STAGE,
+
+	// Commitment performance stage
+	COMMITMENT_PERFORMANCE_STAGE,
+
+	// Bulletproof performance stage
+	BULLETPROOF_PERFORMANCE_STAGE,
+
+	// ChaCha20 Poly1305 performance stage
+	CHACHA20_POLY1305_PERFORMANCE_STAGE,
+
+	// NVM write performance stage
+	NVM_WRITE_PERFORMANCE_STAGE
+};
+
+// Bulletproof performance pass
+enum BulletproofPerformancePass {
+
+	// Bits bulletproof performance pass
+	BITS_BULLETPROOF_PERFORMANCE_PASS,
+
+	// LR generator bulletproof performance pass
+	LR_GENERATOR_BULLETPROOF_PERFORMANCE_PASS,
+
+	// Tau bulletproof performance pass
+	TAU_BULLETPROOF_PERFORMANCE_PASS
+};
+
+// ChaCha20 Poly1305 performance operation
+enum ChaCha20Poly1305PerformanceOperation {
+
+	// Encrypt ChaCha20 Poly1305 performance operation
+	ENCRYPT_CHACHA20_POLY1305_PERFORMANCE_OPERATION,
+
+	// Decrypt ChaCha20 Poly1305 performance operation
+	DECRYPT_CHACHA20_POLY1305_PERFORMANCE_OPERATION
+};
+
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+// Structures
+
+// Performance counter entry
+struct PerformanceCounterEntry {
+
+	// Ticks
+	uint32_t ticks;
+
+	// Stage
+	uint8_t stage;
+
+	// Argument
+	uint8_t argument;
+
+	// Depth
+	uint8_t depth;
+};
+
+// Performance counters
+struct PerformanceCounters {
+
+	// Entries
+	struct PerformanceCounterEntry entries[NUMBER_OF_PERFORMANCE_COUNTER_ENTRIES];
+
+	// Number of recorded entries
+	uint32_t numberOfRecordedEntries;
+
+	// Running stages
+	uint8_t runningStages[MAXIMUM_NUMBER_OF_RUNNING_PERFORMANCE_COUNTERS];
+
+	// Number of running stages
+	uint8_t numberOfRunningStages;
+};
+
+
+// Global variables
+
+// Performance counters
+extern SESSION_LOCAL struct PerformanceCounters performanceCounters;
+
+
+// Function prototypes
+
+// Reset performance counters
+void resetPerformanceCounters(void);
+
+// Record performance counter
+void recordPerformanceCounter(const uint8_t stage, const uint8_t argument);
+
+// Stop running performance counter
+void stopRunningPerformanceCounter(const uint8_t stage);
+
+// Get number of stored performance counter entries
+uint16_t getNumberOfStoredPerformanceCounterEntries(void);
+
+// Get stored performance counter entry
+const struct PerformanceCounterEntry *getStoredPerformanceCounterEntry(const uint16_t index);
+
+#endif
+
+
+#endif
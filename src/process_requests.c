@@ -5,12 +5,14 @@
 #include "common.h"
 #include "commands/continue_decrypting_slate.h"
 #include "commands/continue_encrypting_slate.h"
+#include "commands/continue_getting_commitments.h"
 #include "commands/continue_transaction_apply_offset.h"
 #include "commands/continue_transaction_get_public_key.h"
 #include "commands/continue_transaction_get_public_nonce.h"
 #include "commands/continue_transaction_get_message_signature.h"
 #include "commands/continue_transaction_include_input.h"
 #include "commands/continue_transaction_include_output.h"
+#include "commands/export_transaction.h"
 #include "commands/finish_decrypting_slate.h"
 #include "commands/finish_encrypting_slate.h"
 #include "commands/finish_transaction.h"
@@ -21,21 +23,48 @@
 #include "commands/get_mqs_challenge_signature.h"
 #include "commands/get_root_public_key.h"
 #include "commands/get_seed_cookie.h"
+#include "commands/import_transaction.h"
 #include "menus.h"
+#include "performance_counters.h"
 #include "process_requests.h"
 #include "commands/start_decrypting_slate.h"
 #include "commands/start_encrypting_slate.h"
+#include "commands/start_getting_commitments.h"
 #include "commands/start_transaction.h"
 #include "state.h"
 #include "commands/verify_address.h"
 #include "commands/verify_root_public_key.h"
 
 
+// Function prototypes
+
+// Dispatch request
+static void dispatchRequest(const enum Instruction instruction, volatile unsigned short *responseLength, volatile unsigned char *responseFlags);
+
+// Process batch request
+static void processBatchRequest(volatile unsigned short *responseLength);
+
+// Process batched request
+static unsigned short processBatchedRequest(volatile unsigned short *responseLength);
+
+// Is batchable instruction
+static bool isBatchableInstruction(const enum Instruction instruction);
+
+// Add request to chained request
+static void addRequestToChainedRequest(void);
+
+// Send chained response segment
+static unsigned short sendChainedResponseSegment(volatile unsigned short *responseLength);
+
+
 // Supporting function implementation
 
 // Process request
 void processRequest(const unsigned short requestLength, volatile unsigned short *responseLength, volatile unsigned char *responseFlags) {
 
+	// Start process request performance counter
+	START_PERFORMANCE_COUNTER(PROCESS_REQUEST_PERFORMANCE_STAGE, G_io_apdu_buffer[APDU_OFF_INS]);
+
 	// Begin try
 	BEGIN_TRY {
 
@@ -53,277 +82,616 @@ void processRequest(const unsigned short requestLength, volatile unsigned short
 			const uint8_t class = G_io_apdu_buffer[APDU_OFF_CLA];
 
 			// Check if request's class is unknown
-			if(class != REQUEST_CLASS) {
+			if(class != REQUEST_CLASS && class != CHAINED_REQUEST_CLASS) {
 
 				// Throw unknown class error
 				THROW(UNKNOWN_CLASS_ERROR);
 			}
 
+			// Check if request is a get response request
+			if(class == REQUEST_CLASS && G_io_apdu_buffer[APDU_OFF_INS] == GET_RESPONSE_INSTRUCTION) {
+
+				// Check if parameters or data are invalid
+				if(G_io_apdu_buffer[APDU_OFF_P1] || G_io_apdu_buffer[APDU_OFF_P2] || G_io_apdu_buffer[APDU_OFF_LC]) {
+
+					// Throw invalid parameters error
+					THROW(INVALID_PARAMETERS_ERROR);
+				}
+
+				// Check if a chained response isn't being sent
+				if(chainedApdu.responseOffset == chainedApdu.responseLength) {
+
+					// Throw invalid state error
+					THROW(INVALID_STATE_ERROR);
+				}
+
+				// Send chained response segment and throw its status
+				THROW(sendChainedResponseSegment(responseLength));
+			}
+
+			// Check if request is part of a chained request
+			if(class == CHAINED_REQUEST_CLASS || chainedApdu.requestState == RECEIVING_CHAINED_REQUEST_STATE) {
+
+				// Add request to chained request
+				addRequestToChainedRequest();
+			}
+
+			// Otherwise check if chained APDU is in use
+			else if(chainedApdu.requestState != INACTIVE_CHAINED_REQUEST_STATE || chainedApdu.responseLength) {
+
+				// Reset chained APDU
+				resetChainedApdu();
+			}
+
 			// Get request's instruction
 			const enum Instruction instruction = G_io_apdu_buffer[APDU_OFF_INS];
 
 			// Reset unrelated state
 			resetUnrelatedState(instruction);
 
-			// Check request's instruction
-			switch(instruction) {
+			// Set if creating a chained response
+			chainedApdu.isCreatingResponse = chainedApdu.requestState == COMPLETE_CHAINED_REQUEST_STATE;
 
-				// Get root public key instruction
-				case GET_ROOT_PUBLIC_KEY_INSTRUCTION:
+			// Dispatch request
+			dispatchRequest(instruction, responseLength, responseFlags);
+		}
 
-					// Process get root public key request
-					processGetRootPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+		// Catch IO reset error
+		CATCH(EXCEPTION_IO_RESET) {
 
-					// Break
-					break;
+			// Close try
+			CLOSE_TRY;
 
-				// Get address instruction
-				case GET_ADDRESS_INSTRUCTION:
+			// Stop process request performance counter
+			STOP_PERFORMANCE_COUNTER(PROCESS_REQUEST_PERFORMANCE_STAGE);
 
-					// Process get address request
-					processGetAddressRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Throw IO reset error
+			THROW(EXCEPTION_IO_RESET);
+		}
 
-					// Break
-					break;
+		// Catch length error
+		CATCH(ERR_APD_LEN) {
 
-				// Get seed cookie instruction
-				case GET_SEED_COOKIE_INSTRUCTION:
+			// Close try
+			CLOSE_TRY;
 
-					// Process get seed cookie request
-					processGetSeedCookieRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Stop process request performance counter
+			STOP_PERFORMANCE_COUNTER(PROCESS_REQUEST_PERFORMANCE_STAGE);
 
-					// Break
-					break;
+			// Check if creating a chained response
+			if(chainedApdu.isCreatingResponse) {
 
-				// Get commitment instruction
-				case GET_COMMITMENT_INSTRUCTION:
+				// Clear response
+				*responseLength = 0;
+			}
 
-					// Process get commitment request
-					processGetCommitmentRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Reset chained APDU
+			resetChainedApdu();
 
-					// Break
-					break;
+			// Throw length error
+			THROW(ERR_APD_LEN);
+		}
 
-				// Get bulletproof components instruction
-				case GET_BULLETPROOF_COMPONENTS_INSTRUCTION:
+		// Catch other errors
+		CATCH_OTHER(error) {
 
-					// Process get bulletproof components request
-					processGetBulletproofComponentsRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Close try
+			CLOSE_TRY;
 
-					// Break
-					break;
+			// Stop process request performance counter
+			STOP_PERFORMANCE_COUNTER(PROCESS_REQUEST_PERFORMANCE_STAGE);
 
-				// Verify root public key instruction
-				case VERIFY_ROOT_PUBLIC_KEY_INSTRUCTION:
+			// Check if successful
+			if((error & ERROR_TYPE_MASK) == SWO_SUCCESS) {
 
-					// Process verify root public key request
-					processVerifyRootPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+				// Check if creating a chained response
+				if(chainedApdu.isCreatingResponse) {
 
-					// Break
-					break;
+					// Set that a chained response isn't being created
+					chainedApdu.isCreatingResponse = false;
 
-				// Verify address instruction
-				case VERIFY_ADDRESS_INSTRUCTION:
+					// Set chained response's length to the response's length
+					chainedApdu.responseLength = *responseLength;
 
-					// Process verify address request
-					processVerifyAddressRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+					// Send chained response segment and set error to its status
+					error = sendChainedResponseSegment(responseLength);
+				}
+			}
 
-					// Break
-					break;
+			// Otherwise
+			else {
 
-				// Start encrypting slate instruction
-				case START_ENCRYPTING_SLATE_INSTRUCTION:
+				// Check if creating a chained response
+				if(chainedApdu.isCreatingResponse) {
 
-					// Process start encrypting slate request
-					processStartEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+					// Clear response
+					*responseLength = 0;
+				}
 
-					// Break
-					break;
+				// Reset chained APDU
+				resetChainedApdu();
+			}
 
-				// Continue encrypting slate instruction
-				case CONTINUE_ENCRYPTING_SLATE_INSTRUCTION:
+			// Check error type
+			switch(error & ERROR_TYPE_MASK) {
+
+				// Application errors or success
+				case ERR_APP_RANGE_01:
+				case ERR_APP_RANGE_02:
+				case ERR_APP_RANGE_03:
+				case ERR_APP_RANGE_04:
+				case SWO_SUCCESS:
 
-					// Process continue encrypting slate request
-					processContinueEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+					// Throw error
+					THROW(error);
 
 					// Break
 					break;
 
-				// Finish encrypting slate instruction
-				case FINISH_ENCRYPTING_SLATE_INSTRUCTION:
+				// Default
+				default:
 
-					// Process finish encrypting slate request
-					processFinishEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+					// Throw internal error error
+					THROW(INTERNAL_ERROR_ERROR);
 
 					// Break
 					break;
+			}
+		}
 
-				// Start decrypting slate instruction
-				case START_DECRYPTING_SLATE_INSTRUCTION:
+		// Finally
+		FINALLY {
 
-					// Process start decrypting slate request
-					processStartDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Stop process request performance counter which is only reached if the request didn't throw since the catches stop it before throwing
+			STOP_PERFORMANCE_COUNTER(PROCESS_REQUEST_PERFORMANCE_STAGE);
+		}
+	}
 
-					// Break
-					break;
+	// End try
+	END_TRY;
+}
 
-				// Continue decrypting slate instruction
-				case CONTINUE_DECRYPTING_SLATE_INSTRUCTION:
+// Dispatch request
+void dispatchRequest(const enum Instruction instruction, volatile unsigned short *responseLength, volatile unsigned char *responseFlags) {
 
-					// Process continue decrypting slate request
-					processContinueDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+	// Start command performance counter with cleanup
+	START_PERFORMANCE_COUNTER_WITH_CLEANUP(COMMAND_PERFORMANCE_STAGE, instruction);
 
-					// Break
-					break;
+	// Check request's instruction
+	switch(instruction) {
 
-				// Finish decrypting slate instruction
-				case FINISH_DECRYPTING_SLATE_INSTRUCTION:
+		// Get root public key instruction
+		case GET_ROOT_PUBLIC_KEY_INSTRUCTION:
 
-					// Process finish decrypting slate request
-					processFinishDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process get root public key request
+			processGetRootPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Start transaction instruction
-				case START_TRANSACTION_INSTRUCTION:
+		// Get address instruction
+		case GET_ADDRESS_INSTRUCTION:
 
-					// Process start transaction request
-					processStartTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process get address request
+			processGetAddressRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction include output instruction
-				case CONTINUE_TRANSACTION_INCLUDE_OUTPUT_INSTRUCTION:
+		// Get seed cookie instruction
+		case GET_SEED_COOKIE_INSTRUCTION:
 
-					// Process continue transaction include output request
-					processContinueTransactionIncludeOutputRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process get seed cookie request
+			processGetSeedCookieRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction include input instruction
-				case CONTINUE_TRANSACTION_INCLUDE_INPUT_INSTRUCTION:
+		// Get commitment instruction
+		case GET_COMMITMENT_INSTRUCTION:
 
-					// Process continue transaction include input request
-					processContinueTransactionIncludeInputRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process get commitment request
+			processGetCommitmentRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction apply offset instruction
-				case CONTINUE_TRANSACTION_APPLY_OFFSET_INSTRUCTION:
+		// Get bulletproof components instruction
+		case GET_BULLETPROOF_COMPONENTS_INSTRUCTION:
 
-					// Process continue transaction apply offset request
-					processContinueTransactionApplyOffsetRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process get bulletproof components request
+			processGetBulletproofComponentsRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction get public key instruction
-				case CONTINUE_TRANSACTION_GET_PUBLIC_KEY_INSTRUCTION:
+		// Verify root public key instruction
+		case VERIFY_ROOT_PUBLIC_KEY_INSTRUCTION:
 
-					// Process continue transaction get public key request
-					processContinueTransactionGetPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process verify root public key request
+			processVerifyRootPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction get public nonce instruction
-				case CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION:
+		// Verify address instruction
+		case VERIFY_ADDRESS_INSTRUCTION:
 
-					// Process continue transaction get public nonce request
-					processContinueTransactionGetPublicNonceRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process verify address request
+			processVerifyAddressRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Continue transaction get message signature instruction
-				case CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION:
+		// Start encrypting slate instruction
+		case START_ENCRYPTING_SLATE_INSTRUCTION:
 
-					// Process continue transaction get message signature request
-					processContinueTransactionGetMessageSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process start encrypting slate request
+			processStartEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// break
-					break;
+			// Break
+			break;
 
-				// Finish transaction instruction
-				case FINISH_TRANSACTION_INSTRUCTION:
+		// Continue encrypting slate instruction
+		case CONTINUE_ENCRYPTING_SLATE_INSTRUCTION:
 
-					// Process finish transaction request
-					processFinishTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process continue encrypting slate request
+			processContinueEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
+			// Break
+			break;
 
-				// Get MQS challenge signature instruction
-				case GET_MQS_CHALLENGE_SIGNATURE_INSTRUCTION:
+		// Finish encrypting slate instruction
+		case FINISH_ENCRYPTING_SLATE_INSTRUCTION:
 
-					// Process get MQS challenge signature request
-					processGetMqsChallengeSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process finish encrypting slate request
+			processFinishEncryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// break
-					break;
+			// Break
+			break;
 
-				// Get login challenge signature instruction
-				case GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION:
+		// Start decrypting slate instruction
+		case START_DECRYPTING_SLATE_INSTRUCTION:
 
-					// Process get login challenge signature request
-					processGetLoginChallengeSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+			// Process start decrypting slate request
+			processStartDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// break
-					break;
+			// Break
+			break;
 
-				// Default
-				default:
+		// Continue decrypting slate instruction
+		case CONTINUE_DECRYPTING_SLATE_INSTRUCTION:
 
-					// Throw unknown instruction error
-					THROW(UNKNOWN_INSTRUCTION_ERROR);
+			// Process continue decrypting slate request
+			processContinueDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
 
-					// Break
-					break;
-			}
+			// Break
+			break;
+
+		// Finish decrypting slate instruction
+		case FINISH_DECRYPTING_SLATE_INSTRUCTION:
+
+			// Process finish decrypting slate request
+			processFinishDecryptingSlateRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Start transaction instruction
+		case START_TRANSACTION_INSTRUCTION:
+
+			// Process start transaction request
+			processStartTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction include output instruction
+		case CONTINUE_TRANSACTION_INCLUDE_OUTPUT_INSTRUCTION:
+
+			// Process continue transaction include output request
+			processContinueTransactionIncludeOutputRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction include input instruction
+		case CONTINUE_TRANSACTION_INCLUDE_INPUT_INSTRUCTION:
+
+			// Process continue transaction include input request
+			processContinueTransactionIncludeInputRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction apply offset instruction
+		case CONTINUE_TRANSACTION_APPLY_OFFSET_INSTRUCTION:
+
+			// Process continue transaction apply offset request
+			processContinueTransactionApplyOffsetRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction get public key instruction
+		case CONTINUE_TRANSACTION_GET_PUBLIC_KEY_INSTRUCTION:
+
+			// Process continue transaction get public key request
+			processContinueTransactionGetPublicKeyRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction get public nonce instruction
+		case CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION:
+
+			// Process continue transaction get public nonce request
+			processContinueTransactionGetPublicNonceRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Continue transaction get message signature instruction
+		case CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION:
+
+			// Process continue transaction get message signature request
+			processContinueTransactionGetMessageSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Finish transaction instruction
+		case FINISH_TRANSACTION_INSTRUCTION:
+
+			// Process finish transaction request
+			processFinishTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// Break
+			break;
+
+		// Get MQS challenge signature instruction
+		case GET_MQS_CHALLENGE_SIGNATURE_INSTRUCTION:
+
+			// Process get MQS challenge signature request
+			processGetMqsChallengeSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Get login challenge signature instruction
+		case GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION:
+
+			// Process get login challenge signature request
+			processGetLoginChallengeSignatureRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Start getting commitments instruction
+		case START_GETTING_COMMITMENTS_INSTRUCTION:
+
+			// Process start getting commitments request
+			processStartGettingCommitmentsRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Continue getting commitments instruction
+		case CONTINUE_GETTING_COMMITMENTS_INSTRUCTION:
+
+			// Process continue getting commitments request
+			processContinueGettingCommitmentsRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Export transaction instruction
+		case EXPORT_TRANSACTION_INSTRUCTION:
+
+			// Process export transaction request
+			processExportTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Import transaction instruction
+		case IMPORT_TRANSACTION_INSTRUCTION:
+
+			// Process import transaction request
+			processImportTransactionRequest((unsigned short *)responseLength, (unsigned char *)responseFlags);
+
+			// break
+			break;
+
+		// Batch instruction
+		case BATCH_INSTRUCTION:
+
+			// Process batch request
+			processBatchRequest(responseLength);
+
+			// break
+			break;
+
+		// Default
+		default:
+
+			// Throw unknown instruction error
+			THROW(UNKNOWN_INSTRUCTION_ERROR);
+
+			// Break
+			break;
+	}
+
+	// Stop command performance counter with cleanup
+	STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(COMMAND_PERFORMANCE_STAGE);
+}
+
+// Process batch request
+void processBatchRequest(volatile unsigned short *responseLength) {
+
+	// Get request's first parameter
+	const uint8_t firstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's second parameter
+	const uint8_t secondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+	// Get request's data length
+	const size_t dataLength = getRequestDataLength();
+
+	// Get request's data
+	const uint8_t *data = getRequestData();
+
+	// Check if parameters or data are invalid
+	if(firstParameter || secondParameter || !dataLength) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Go through all batched requests in the data
+	for(size_t offset = 0; offset < dataLength; offset += APDU_OFF_DATA + data[offset + APDU_OFF_LC]) {
+
+		// Check if batched request is malformed
+		if(dataLength - offset < APDU_OFF_DATA || dataLength - offset - APDU_OFF_DATA < data[offset + APDU_OFF_LC] || data[offset + APDU_OFF_CLA] != REQUEST_CLASS) {
+
+			// Throw invalid parameters error
+			THROW(INVALID_PARAMETERS_ERROR);
 		}
+	}
 
-		// Catch IO reset error
-		CATCH(EXCEPTION_IO_RESET) {
+	// Check if request wasn't chained
+	if(chainedApdu.requestState != COMPLETE_CHAINED_REQUEST_STATE) {
 
-			// Close try
-			CLOSE_TRY;
+		// Move request's data into the chained APDU buffer since the batched requests will overwrite the APDU buffer
+		memcpy(chainedApdu.buffer, data, dataLength);
 
-			// Throw IO reset error
-			THROW(EXCEPTION_IO_RESET);
+		chainedApdu.requestDataLength = dataLength;
+
+		// Set that chained request is complete
+		chainedApdu.requestState = COMPLETE_CHAINED_REQUEST_STATE;
+
+		// Set that a chained response is being created
+		chainedApdu.isCreatingResponse = true;
+	}
+
+	// Go through all batched requests in the chained APDU buffer
+	for(size_t offset = 0; offset < chainedApdu.requestDataLength; offset += APDU_OFF_DATA + chainedApdu.buffer[offset + APDU_OFF_LC]) {
+
+		// Check if batched request's instruction isn't batchable
+		if(!isBatchableInstruction(chainedApdu.buffer[offset + APDU_OFF_INS])) {
+
+			// Break
+			break;
 		}
 
-		// Catch length error
-		CATCH(ERR_APD_LEN) {
+		// Copy batched request into the APDU buffer
+		memcpy(G_io_apdu_buffer, &chainedApdu.buffer[offset], APDU_OFF_DATA + chainedApdu.buffer[offset + APDU_OFF_LC]);
 
-			// Close try
-			CLOSE_TRY;
+		// Set that the chained APDU isn't used by the batched request
+		chainedApdu.requestState = INACTIVE_CHAINED_REQUEST_STATE;
+		chainedApdu.isCreatingResponse = false;
+
+		// Process batched request
+		unsigned short batchedResponseLength = 0;
+		const unsigned short status = processBatchedRequest(&batchedResponseLength);
+
+		// Set that the chained APDU is used by the batch request
+		chainedApdu.requestState = COMPLETE_CHAINED_REQUEST_STATE;
+		chainedApdu.isCreatingResponse = true;
+
+		// Check if batched request's response is too long or response with the batched request's record will overflow
+		if(batchedResponseLength > UINT8_MAX || willResponseOverflow(*responseLength, BATCH_RECORD_HEADER_SIZE + batchedResponseLength)) {
 
 			// Throw length error
 			THROW(ERR_APD_LEN);
 		}
 
-		// Catch other errors
-		CATCH_OTHER(error) {
+		// Append batched request's status to response
+		U2BE_ENCODE(getResponseBuffer(), *responseLength, status);
+
+		*responseLength += sizeof(status);
+
+		// Append batched request's response length to response
+		getResponseBuffer()[*responseLength] = batchedResponseLength;
+
+		*responseLength += sizeof(uint8_t);
+
+		// Append batched request's response to response
+		memcpy(&getResponseBuffer()[*responseLength], G_io_apdu_buffer, batchedResponseLength);
+
+		*responseLength += batchedResponseLength;
+
+		// Check if batched request failed
+		if(status != SWO_SUCCESS) {
+
+			// Break
+			break;
+		}
+	}
+
+	// Throw success
+	THROW(SWO_SUCCESS);
+}
+
+// Process batched request
+unsigned short processBatchedRequest(volatile unsigned short *responseLength) {
+
+	// Initialize status
+	volatile unsigned short status = SWO_SUCCESS;
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Get request's instruction
+			const enum Instruction instruction = G_io_apdu_buffer[APDU_OFF_INS];
+
+			// Reset unrelated state
+			resetUnrelatedState(instruction);
+
+			// Dispatch request
+			unsigned char responseFlags = 0;
+			dispatchRequest(instruction, responseLength, &responseFlags);
+		}
+
+		// Catch IO reset error
+		CATCH(EXCEPTION_IO_RESET) {
 
 			// Close try
 			CLOSE_TRY;
 
+			// Throw IO reset error
+			THROW(EXCEPTION_IO_RESET);
+		}
+
+		// Catch other errors
+		CATCH_OTHER(error) {
+
 			// Check error type
 			switch(error & ERROR_TYPE_MASK) {
 
-				// Application errors or success
+				// Lower application errors
 				case ERR_APP_RANGE_01:
 				case ERR_APP_RANGE_02:
+
+					// Reset state
+					resetState();
+
+					// Set status to the error
+					status = error;
+
+					// Break
+					break;
+
+				// Higher application errors or success
 				case ERR_APP_RANGE_03:
 				case ERR_APP_RANGE_04:
 				case SWO_SUCCESS:
 
-					// Throw error
-					THROW(error);
+					// Set status to the error
+					status = error;
 
 					// Break
 					break;
@@ -331,12 +699,22 @@ void processRequest(const unsigned short requestLength, volatile unsigned short
 				// Default
 				default:
 
-					// Throw internal error error
-					THROW(INTERNAL_ERROR_ERROR);
+					// Reset state
+					resetState();
+
+					// Set status to internal error error
+					status = INTERNAL_ERROR_ERROR;
 
 					// Break
 					break;
 			}
+
+			// Check if status isn't success
+			if(status != SWO_SUCCESS) {
+
+				// Clear response
+				*responseLength = 0;
+			}
 		}
 
 		// Finally
@@ -346,6 +724,120 @@ void processRequest(const unsigned short requestLength, volatile unsigned short
 
 	// End try
 	END_TRY;
+
+	// Return status
+	return status;
+}
+
+// Is batchable instruction
+bool isBatchableInstruction(const enum Instruction instruction) {
+
+	// Check instruction
+	switch(instruction) {
+
+		// Instructions that don't require user interaction
+		case GET_ADDRESS_INSTRUCTION:
+		case GET_SEED_COOKIE_INSTRUCTION:
+		case GET_COMMITMENT_INSTRUCTION:
+		case START_ENCRYPTING_SLATE_INSTRUCTION:
+		case CONTINUE_ENCRYPTING_SLATE_INSTRUCTION:
+		case FINISH_ENCRYPTING_SLATE_INSTRUCTION:
+		case START_DECRYPTING_SLATE_INSTRUCTION:
+		case CONTINUE_DECRYPTING_SLATE_INSTRUCTION:
+		case FINISH_DECRYPTING_SLATE_INSTRUCTION:
+		case START_TRANSACTION_INSTRUCTION:
+		case CONTINUE_TRANSACTION_INCLUDE_OUTPUT_INSTRUCTION:
+		case CONTINUE_TRANSACTION_INCLUDE_INPUT_INSTRUCTION:
+		case CONTINUE_TRANSACTION_APPLY_OFFSET_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_PUBLIC_KEY_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION:
+		case START_GETTING_COMMITMENTS_INSTRUCTION:
+		case CONTINUE_GETTING_COMMITMENTS_INSTRUCTION:
+		case EXPORT_TRANSACTION_INSTRUCTION:
+		case IMPORT_TRANSACTION_INSTRUCTION:
+
+			// Return true
+			return true;
+
+		// Default
+		default:
+
+			// Return false
+			return false;
+	}
+}
+
+// Add request to chained request
+void addRequestToChainedRequest(void) {
+
+	// Check if chained request isn't receiving
+	if(chainedApdu.requestState != RECEIVING_CHAINED_REQUEST_STATE) {
+
+		// Reset chained APDU
+		resetChainedApdu();
+
+		// Set chained request's instruction and parameters to the request's
+		chainedApdu.requestInstruction = G_io_apdu_buffer[APDU_OFF_INS];
+		chainedApdu.requestFirstParameter = G_io_apdu_buffer[APDU_OFF_P1];
+		chainedApdu.requestSecondParameter = G_io_apdu_buffer[APDU_OFF_P2];
+
+		// Set that chained request is receiving
+		chainedApdu.requestState = RECEIVING_CHAINED_REQUEST_STATE;
+	}
+
+	// Otherwise check if request's instruction or parameters differ from the chained request's
+	else if(G_io_apdu_buffer[APDU_OFF_INS] != chainedApdu.requestInstruction || G_io_apdu_buffer[APDU_OFF_P1] != chainedApdu.requestFirstParameter || G_io_apdu_buffer[APDU_OFF_P2] != chainedApdu.requestSecondParameter) {
+
+		// Throw malformed request error
+		THROW(MALFORMED_REQUEST_ERROR);
+	}
+
+	// Check if request's data won't fit in the chained request
+	if(G_io_apdu_buffer[APDU_OFF_LC] > sizeof(chainedApdu.buffer) - chainedApdu.requestDataLength) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Append request's data to the chained request
+	memcpy(&chainedApdu.buffer[chainedApdu.requestDataLength], &G_io_apdu_buffer[APDU_OFF_DATA], G_io_apdu_buffer[APDU_OFF_LC]);
+
+	chainedApdu.requestDataLength += G_io_apdu_buffer[APDU_OFF_LC];
+
+	// Check if more requests are part of the chained request
+	if(G_io_apdu_buffer[APDU_OFF_CLA] == CHAINED_REQUEST_CLASS) {
+
+		// Throw success
+		THROW(SWO_SUCCESS);
+	}
+
+	// Set that chained request is complete
+	chainedApdu.requestState = COMPLETE_CHAINED_REQUEST_STATE;
+}
+
+// Send chained response segment
+unsigned short sendChainedResponseSegment(volatile unsigned short *responseLength) {
+
+	// Get segment's length
+	const size_t segmentLength = MIN(chainedApdu.responseLength - chainedApdu.responseOffset, RESPONSE_SEGMENT_SIZE);
+
+	// Set response to the segment
+	memcpy(G_io_apdu_buffer, &chainedApdu.buffer[chainedApdu.requestDataLength + chainedApdu.responseOffset], segmentLength);
+
+	*responseLength = segmentLength;
+
+	chainedApdu.responseOffset += segmentLength;
+
+	// Check if chained response has more segments
+	if(chainedApdu.responseOffset != chainedApdu.responseLength) {
+
+		// Return more response data status
+		return MORE_RESPONSE_DATA_STATUS;
+	}
+
+	// Return success
+	return SWO_SUCCESS;
 }
 
 // Process user interaction
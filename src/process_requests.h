@@ -6,6 +6,7 @@
 // Header files
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 
 // Definitions
@@ -13,6 +14,18 @@
 // Request class
 #define REQUEST_CLASS 0xC7
 
+// Chained request class
+#define CHAINED_REQUEST_CLASS (REQUEST_CLASS | 0x10)
+
+// Get response instruction
+#define GET_RESPONSE_INSTRUCTION 0xC0
+
+// Response segment size
+#define RESPONSE_SEGMENT_SIZE UINT8_MAX
+
+// Batch record header size
+#define BATCH_RECORD_HEADER_SIZE (sizeof(uint16_t) + sizeof(uint8_t))
+
 
 // Constants
 
@@ -86,7 +99,22 @@ enum Instruction {
 	GET_MQS_CHALLENGE_SIGNATURE_INSTRUCTION,
 
 	// Get login challenge signature instruction
-	GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION
+	GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION,
+
+	// Start getting commitments instruction
+	START_GETTING_COMMITMENTS_INSTRUCTION,
+
+	// Continue getting commitments instruction
+	CONTINUE_GETTING_COMMITMENTS_INSTRUCTION,
+
+	// Export transaction instruction
+	EXPORT_TRANSACTION_INSTRUCTION,
+
+	// Import transaction instruction
+	IMPORT_TRANSACTION_INSTRUCTION,
+
+	// Batch instruction
+	BATCH_INSTRUCTION
 };
 
 
@@ -0,0 +1,101 @@
+// Header files
+#include <string.h>
+#include "common.h"
+#include "root_public_key_cache.h"
+
+
+// Global variables
+
+// Root public key cache
+SESSION_LOCAL struct RootPublicKeyCache rootPublicKeyCache;
+
+
+// Function prototypes
+
+// Get root public key cache entry
+static struct RootPublicKeyCacheEntry *getRootPublicKeyCacheEntry(const uint32_t account);
+
+
+// Supporting function implementation
+
+// Reset root public key cache
+void resetRootPublicKeyCache(void) {
+
+	// Clear the root public key cache
+	explicit_bzero(&rootPublicKeyCache, sizeof(rootPublicKeyCache));
+}
+
+// Get cached root public key
+bool getCachedRootPublicKey(volatile uint8_t *rootPublicKey, const uint32_t account) {
+
+	// Check if the root public key cache doesn't have an entry for the account
+	struct RootPublicKeyCacheEntry *entry = getRootPublicKeyCacheEntry(account);
+	if(!entry) {
+
+		// Return false
+		return false;
+	}
+
+	// Set root public key to the entry's root public key
+	memcpy((uint8_t *)rootPublicKey, entry->rootPublicKey, sizeof(entry->rootPublicKey));
+
+	// Set entry's last used to the next use counter
+	entry->lastUsed = ++rootPublicKeyCache.useCounter;
+
+	// Return true
+	return true;
+}
+
+// Cache root public key
+void cacheRootPublicKey(const uint8_t *rootPublicKey, const uint32_t account) {
+
+	// Check if the root public key cache doesn't have an entry for the account
+	struct RootPublicKeyCacheEntry *entry = getRootPublicKeyCacheEntry(account);
+	if(!entry) {
+
+		// Go through all entries in the root public key cache
+		for(size_t i = 0; i < NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES; ++i) {
+
+			// Check if no entry has been chosen yet, the chosen entry is used, and the entry is unused or was used less recently
+			if(!entry || (entry->used && (!rootPublicKeyCache.entries[i].used || rootPublicKeyCache.entries[i].lastUsed < entry->lastUsed))) {
+
+				// Set entry to the entry
+				entry = &rootPublicKeyCache.entries[i];
+			}
+		}
+
+		// Clear the entry
+		explicit_bzero(entry, sizeof(*entry));
+
+		// Set entry's account
+		entry->account = account;
+
+		// Set that entry is used
+		entry->used = true;
+	}
+
+	// Set entry's root public key
+	memcpy(entry->rootPublicKey, rootPublicKey, sizeof(entry->rootPublicKey));
+
+	// Set entry's last used to the next use counter
+	entry->lastUsed = ++rootPublicKeyCache.useCounter;
+}
+
+// Get root public key cache entry
+struct RootPublicKeyCacheEntry *getRootPublicKeyCacheEntry(const uint32_t account) {
+
+	// Go through all entries in the root public key cache
+	for(size_t i = 0; i < NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES; ++i) {
+
+		// Check if entry is for the account
+		struct RootPublicKeyCacheEntry *entry = &rootPublicKeyCache.entries[i];
+		if(entry->used && entry->account == account) {
+
+			// Return entry
+			return entry;
+		}
+	}
+
+	// Return null
+	return NULL;
+}
@@ -0,0 +1,75 @@
+// Header guard
+#ifndef ROOT_PUBLIC_KEY_CACHE_H
+#define ROOT_PUBLIC_KEY_CACHE_H
+
+
+// Header files
+#include <stdbool.h>
+#include <stdint.h>
+#include "crypto.h"
+
+
+// Definitions
+
+// Check if target is Nano S
+#ifdef TARGET_NANOS
+
+	// Number of root public key cache entries
+	#define NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES 2
+
+// Otherwise
+#else
+
+	// Number of root public key cache entries
+	#define NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES 8
+#endif
+
+
+// Structures
+
+// Root public key cache entry
+struct RootPublicKeyCacheEntry {
+
+	// Used
+	bool used;
+
+	// Last used
+	uint32_t lastUsed;
+
+	// Account
+	uint32_t account;
+
+	// Root public key
+	uint8_t rootPublicKey[COMPRESSED_PUBLIC_KEY_SIZE];
+};
+
+// Root public key cache
+struct RootPublicKeyCache {
+
+	// Entries
+	struct RootPublicKeyCacheEntry entries[NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES];
+
+	// Use counter
+	uint32_t useCounter;
+};
+
+
+// Global variables
+
+// Root public key cache
+extern SESSION_LOCAL struct RootPublicKeyCache rootPublicKeyCache;
+
+
+// Function prototypes
+
+// Reset root public key cache
+void resetRootPublicKeyCache(void);
+
+// Get cached root public key
+bool getCachedRootPublicKey(volatile uint8_t *rootPublicKey, const uint32_t account);
+
+// Cache root public key
+void cacheRootPublicKey(const uint8_t *rootPublicKey, const uint32_t account);
+
+
+#endif
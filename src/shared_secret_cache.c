@@ -0,0 +1,128 @@
+// Header files
+#include <string.h>
+#include "common.h"
+#include "shared_secret_cache.h"
+
+
+// Global variables
+
+// Shared secret cache
+SESSION_LOCAL struct SharedSecretCache sharedSecretCache;
+
+
+// Function prototypes
+
+// Get shared secret cache entry
+static struct SharedSecretCacheEntry *getSharedSecretCacheEntry(const uint32_t account, const uint32_t index, const char *address, const size_t addressLength);
+
+
+// Supporting function implementation
+
+// Reset shared secret cache
+void resetSharedSecretCache(void) {
+
+	// Clear the shared secret cache
+	explicit_bzero(&sharedSecretCache, sizeof(sharedSecretCache));
+}
+
+// Get cached shared secret
+bool getCachedSharedSecret(volatile uint8_t *secret, const uint32_t account, const uint32_t index, const char *address, const size_t addressLength) {
+
+	// Check if the shared secret cache doesn't have an entry for the account, index, and address
+	struct SharedSecretCacheEntry *entry = getSharedSecretCacheEntry(account, index, address, addressLength);
+	if(!entry) {
+
+		// Return false
+		return false;
+	}
+
+	// Set secret to the entry's secret
+	memcpy((uint8_t *)secret, (uint8_t *)entry->secret, sizeof(entry->secret));
+
+	// Set entry's last used to the next use counter
+	entry->lastUsed = ++sharedSecretCache.useCounter;
+
+	// Reset the shared secret cache's inactive ticks
+	sharedSecretCache.inactiveTicks = 0;
+
+	// Return true
+	return true;
+}
+
+// Cache shared secret
+void cacheSharedSecret(const uint8_t *secret, const uint32_t account, const uint32_t index, const char *address, const size_t addressLength) {
+
+	// Check if address can't be cached
+	if(addressLength > SHARED_SECRET_CACHE_MAXIMUM_ADDRESS_SIZE) {
+
+		// Return
+		return;
+	}
+
+	// Check if the shared secret cache doesn't have an entry for the account, index, and address
+	struct SharedSecretCacheEntry *entry = getSharedSecretCacheEntry(account, index, address, addressLength);
+	if(!entry) {
+
+		// Go through all entries in the shared secret cache
+		for(size_t i = 0; i < NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES; ++i) {
+
+			// Check if no entry has been chosen yet, the chosen entry is used, and the entry is unused or was used less recently
+			if(!entry || (entry->used && (!sharedSecretCache.entries[i].used || sharedSecretCache.entries[i].lastUsed < entry->lastUsed))) {
+
+				// Set entry to the entry
+				entry = &sharedSecretCache.entries[i];
+			}
+		}
+
+		// Clear the entry
+		explicit_bzero(entry, sizeof(*entry));
+
+		// Set entry's account, index, and address
+		entry->account = account;
+		entry->index = index;
+		entry->addressLength = addressLength;
+		memcpy(entry->address, address, addressLength);
+
+		// Set that entry is used
+		entry->used = true;
+	}
+
+	// Set entry's secret
+	memcpy((uint8_t *)entry->secret, secret, sizeof(entry->secret));
+
+	// Set entry's last used to the next use counter
+	entry->lastUsed = ++sharedSecretCache.useCounter;
+
+	// Reset the shared secret cache's inactive ticks
+	sharedSecretCache.inactiveTicks = 0;
+}
+
+// Tick shared secret cache
+void tickSharedSecretCache(void) {
+
+	// Check if the shared secret cache has been inactive for too long
+	if(++sharedSecretCache.inactiveTicks >= SHARED_SECRET_CACHE_TIMEOUT_TICKS) {
+
+		// Reset the shared secret cache
+		resetSharedSecretCache();
+	}
+}
+
+// Get shared secret cache entry
+struct SharedSecretCacheEntry *getSharedSecretCacheEntry(const uint32_t account, const uint32_t index, const char *address, const size_t addressLength) {
+
+	// Go through all entries in the shared secret cache
+	for(size_t i = 0; i < NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES; ++i) {
+
+		// Check if entry is for the account, index, and address
+		struct SharedSecretCacheEntry *entry = &sharedSecretCache.entries[i];
+		if(entry->used && entry->account == account && entry->index == index && entry->addressLength == addressLength && !memcmp(entry->address, address, addressLength)) {
+
+			// Return entry
+			return entry;
+		}
+	}
+
+	// Return null
+	return NULL;
+}
@@ -0,0 +1,101 @@
+// Header guard
+#ifndef SHARED_SECRET_CACHE_H
+#define SHARED_SECRET_CACHE_H
+
+
+// Header files
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "mqs.h"
+#include "tor.h"
+
+
+// Definitions
+
+// Shared secret cache secret size
+#define SHARED_SECRET_CACHE_SECRET_SIZE 32
+
+// Shared secret cache maximum address size
+#define SHARED_SECRET_CACHE_MAXIMUM_ADDRESS_SIZE MAX(MQS_ADDRESS_SIZE, TOR_ADDRESS_SIZE)
+
+// Check if target is Nano S
+#ifdef TARGET_NANOS
+
+	// Number of shared secret cache entries
+	#define NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES 2
+
+// Otherwise
+#else
+
+	// Number of shared secret cache entries
+	#define NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES 8
+#endif
+
+// Shared secret cache timeout ticks (five minutes of 100 millisecond ticker events)
+#define SHARED_SECRET_CACHE_TIMEOUT_TICKS (5 * 60 * 10)
+
+
+// Structures
+
+// Shared secret cache entry
+struct SharedSecretCacheEntry {
+
+	// Used
+	bool used;
+
+	// Last used
+	uint32_t lastUsed;
+
+	// Account
+	uint32_t account;
+
+	// Index
+	uint32_t index;
+
+	// Address length
+	uint8_t addressLength;
+
+	// Address
+	char address[SHARED_SECRET_CACHE_MAXIMUM_ADDRESS_SIZE];
+
+	// Secret
+	volatile uint8_t secret[SHARED_SECRET_CACHE_SECRET_SIZE];
+};
+
+// Shared secret cache
+struct SharedSecretCache {
+
+	// Entries
+	struct SharedSecretCacheEntry entries[NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES];
+
+	// Use counter
+	uint32_t useCounter;
+
+	// Inactive ticks
+	uint16_t inactiveTicks;
+};
+
+
+// Global variables
+
+// Shared secret cache
+extern SESSION_LOCAL struct SharedSecretCache sharedSecretCache;
+
+
+// Function prototypes
+
+// Reset shared secret cache
+void resetSharedSecretCache(void);
+
+// Get cached shared secret
+bool getCachedSharedSecret(volatile uint8_t *secret, const uint32_t account, const uint32_t index, const char *address, const size_t addressLength);
+
+// Cache shared secret
+void cacheSharedSecret(const uint8_t *secret, const uint32_t account, const uint32_t index, const char *address, const size_t addressLength);
+
+// Tick shared secret cache
+void tickSharedSecretCache(void);
+
+
+#endif
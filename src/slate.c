@@ -7,7 +7,16 @@
 // Global variables
 
 // Slate
-struct Slate slate;
+SESSION_LOCAL struct Slate slate;
+
+
+// Function prototypes
+
+// Is slate session active
+static bool isSlateSessionActive(const struct SlateSession *session);
+
+// Use slate session
+static void useSlateSession(struct SlateSession *session);
 
 
 // Supporting function implementation
@@ -18,3 +27,96 @@ void resetSlate(void) {
 	// Clear the slate
 	explicit_bzero(&slate, sizeof(slate));
 }
+
+// Start slate session
+struct SlateSession *startSlateSession(const uint8_t handle) {
+
+	// Initialize session
+	struct SlateSession *session = NULL;
+
+	// Go through all slate sessions
+	for(size_t i = 0; i < NUMBER_OF_SLATE_SESSIONS; ++i) {
+
+		// Check if slate session is active and has the handle
+		if(isSlateSessionActive(&slate.sessions[i]) && slate.sessions[i].handle == handle) {
+
+			// Set session to the slate session
+			session = &slate.sessions[i];
+
+			// Break
+			break;
+		}
+
+		// Otherwise check if no session has been chosen yet, the chosen session is active, and the slate session is inactive or was used less recently
+		else if(!session || (isSlateSessionActive(session) && (!isSlateSessionActive(&slate.sessions[i]) || slate.sessions[i].lastUsed < session->lastUsed))) {
+
+			// Set session to the slate session
+			session = &slate.sessions[i];
+		}
+	}
+
+	// Reset the session
+	resetSlateSession(session);
+
+	// Set session's handle
+	session->handle = handle;
+
+	// Use the session
+	useSlateSession(session);
+
+	// Return session
+	return session;
+}
+
+// Get slate session
+struct SlateSession *getSlateSession(const uint8_t handle) {
+
+	// Go through all slate sessions
+	struct SlateSession *session = NULL;
+	for(size_t i = 0; i < NUMBER_OF_SLATE_SESSIONS; ++i) {
+
+		// Check if slate session is active and has the handle
+		if(isSlateSessionActive(&slate.sessions[i]) && slate.sessions[i].handle == handle) {
+
+			// Set session to the slate session
+			session = &slate.sessions[i];
+
+			// Break
+			break;
+		}
+	}
+
+	// Check if session doesn't exist
+	if(!session) {
+
+		// Throw invalid state error
+		THROW(INVALID_STATE_ERROR);
+	}
+
+	// Use the session
+	useSlateSession(session);
+
+	// Return session
+	return session;
+}
+
+// Reset slate session
+void resetSlateSession(struct SlateSession *session) {
+
+	// Clear the session
+	explicit_bzero(session, sizeof(*session));
+}
+
+// Is slate session active
+bool isSlateSessionActive(const struct SlateSession *session) {
+
+	// Return if the session is encrypting or decrypting
+	return session->encryptingState != INACTIVE_SLATE_STATE || session->decryptingState != INACTIVE_SLATE_STATE;
+}
+
+// Use slate session
+void useSlateSession(struct SlateSession *session) {
+
+	// Set session's last used to the next use counter
+	session->lastUsed = ++slate.useCounter;
+}
@@ -6,6 +6,7 @@
 // Header files
 #include "chacha20_poly1305.h"
 #include "common.h"
+#include "crypto.h"
 
 
 // Definitions
@@ -13,6 +14,22 @@
 // Slate session key size
 #define SLATE_SESSION_KEY_SIZE 32
 
+// Slate maximum chunk size
+#define SLATE_MAXIMUM_CHUNK_SIZE ((UINT8_MAX / CHACHA20_BLOCK_SIZE) * CHACHA20_BLOCK_SIZE)
+
+// Check if target is Nano S
+#ifdef TARGET_NANOS
+
+	// Number of slate sessions
+	#define NUMBER_OF_SLATE_SESSIONS 2
+
+// Otherwise
+#else
+
+	// Number of slate sessions
+	#define NUMBER_OF_SLATE_SESSIONS 4
+#endif
+
 
 // Constants
 
@@ -32,11 +49,37 @@ enum SlateState {
 	COMPLETE_SLATE_STATE
 };
 
+// Slate chunk type
+enum SlateChunkType {
+
+	// More slate chunk type
+	MORE_SLATE_CHUNK_TYPE,
+
+	// Last slate chunk type
+	LAST_SLATE_CHUNK_TYPE
+};
+
+// Slate session cipher version
+enum SlateSessionCipherVersion {
+
+	// Padded chunks slate session cipher version
+	PADDED_CHUNKS_SLATE_SESSION_CIPHER_VERSION,
+
+	// Streaming slate session cipher version
+	STREAMING_SLATE_SESSION_CIPHER_VERSION
+};
+
 
 // Structures
 
-// Slate
-struct Slate {
+// Slate session
+struct SlateSession {
+
+	// Handle
+	uint8_t handle;
+
+	// Last used
+	uint32_t lastUsed;
 
 	// Account
 	uint32_t account;
@@ -53,6 +96,12 @@ struct Slate {
 	// Session key
 	uint8_t sessionKey[SLATE_SESSION_KEY_SIZE];
 
+	// Session cipher version
+	enum SlateSessionCipherVersion sessionCipherVersion;
+
+	// Session cipher
+	volatile struct SessionCipher sessionCipher;
+
 	// Message hash state
 	cx_sha256_t messageHashState;
 
@@ -60,11 +109,21 @@ struct Slate {
 	volatile ChaCha20Poly1305State chaCha20Poly1305State;
 };
 
+// Slate
+struct Slate {
+
+	// Sessions
+	struct SlateSession sessions[NUMBER_OF_SLATE_SESSIONS];
+
+	// Use counter
+	uint32_t useCounter;
+};
+
 
 // Global variables
 
 // Slate
-extern struct Slate slate;
+extern SESSION_LOCAL struct Slate slate;
 
 
 // Function prototypes
@@ -72,5 +131,14 @@ extern struct Slate slate;
 // Reset slate
 void resetSlate(void);
 
+// Start slate session
+struct SlateSession *startSlateSession(const uint8_t handle);
+
+// Get slate session
+struct SlateSession *getSlateSession(const uint8_t handle);
+
+// Reset slate session
+void resetSlateSession(struct SlateSession *session);
+
 
 #endif
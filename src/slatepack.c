@@ -2,6 +2,7 @@
 #include <string.h>
 #include "common.h"
 #include "crypto.h"
+#include "shared_secret_cache.h"
 #include "slatepack.h"
 #include "tor.h"
 
@@ -11,6 +12,13 @@
 // Create Slatepack shared private key
 void createSlatepackSharedPrivateKey(volatile uint8_t *sharedPrivateKey, const uint32_t account, const uint32_t index, const char *address, const size_t addressLength) {
 
+	// Check if the shared private key is cached
+	if(getCachedSharedSecret(sharedPrivateKey, account, index, address, addressLength)) {
+
+		// Return
+		return;
+	}
+
 	// Check address length
 	cx_ecfp_public_key_t publicKey;
 	switch(addressLength) {
@@ -82,6 +90,9 @@ void createSlatepackSharedPrivateKey(volatile uint8_t *sharedPrivateKey, const u
 				// Throw internal error error
 				THROW(INTERNAL_ERROR_ERROR);
 			}
+
+			// Cache the shared private key
+			cacheSharedSecret((uint8_t *)sharedPrivateKey, account, index, address, addressLength);
 		}
 
 		// Finally
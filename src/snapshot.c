@@ -0,0 +1,201 @@
+// Check if fuzzing
+#ifdef FUZZING
+
+// Header files
+#include <string.h>
+#include "snapshot.h"
+
+
+// Supporting function implementation
+
+// Take snapshot
+void takeSnapshot(struct Snapshot *snapshot) {
+
+	// Copy transaction into the snapshot
+	memcpy(&snapshot->transaction, &transaction, sizeof(snapshot->transaction));
+
+	// Copy transaction exports into the snapshot
+	memcpy(&snapshot->transactionExports, &transactionExports, sizeof(snapshot->transactionExports));
+
+	// Copy slate into the snapshot
+	memcpy(&snapshot->slate, &slate, sizeof(snapshot->slate));
+
+	// Copy commitments into the snapshot
+	memcpy(&snapshot->commitments, &commitments, sizeof(snapshot->commitments));
+
+	// Copy shared secret cache into the snapshot
+	memcpy(&snapshot->sharedSecretCache, &sharedSecretCache, sizeof(snapshot->sharedSecretCache));
+
+	// Copy root public key cache into the snapshot
+	memcpy(&snapshot->rootPublicKeyCache, &rootPublicKeyCache, sizeof(snapshot->rootPublicKeyCache));
+
+	// Copy chained APDU into the snapshot
+	memcpy(&snapshot->chainedApdu, &chainedApdu, sizeof(snapshot->chainedApdu));
+
+	// Copy persistent storage into the snapshot
+	memcpy(&snapshot->persistentStorage, &N_PERSISTENTSTORAGE, sizeof(snapshot->persistentStorage));
+
+	// Copy IO APDU buffer into the snapshot
+	memcpy(snapshot->ioApduBuffer, G_io_apdu_buffer, sizeof(snapshot->ioApduBuffer));
+
+	// Copy time line buffer into the snapshot
+	memcpy(snapshot->timeLineBuffer, timeLineBuffer, sizeof(snapshot->timeLineBuffer));
+
+	// Copy progress bar message line buffer into the snapshot
+	memcpy(snapshot->progressBarMessageLineBuffer, progressBarMessageLineBuffer, sizeof(snapshot->progressBarMessageLineBuffer));
+
+	// Copy public key line buffer into the snapshot
+	memcpy(snapshot->publicKeyLineBuffer, (char *)publicKeyLineBuffer, sizeof(snapshot->publicKeyLineBuffer));
+
+	// Copy address line buffer into the snapshot
+	memcpy(snapshot->addressLineBuffer, addressLineBuffer, sizeof(snapshot->addressLineBuffer));
+
+	// Copy verify address line buffer into the snapshot
+	memcpy(snapshot->verifyAddressLineBuffer, verifyAddressLineBuffer, sizeof(snapshot->verifyAddressLineBuffer));
+
+	// Copy approve transaction line buffer into the snapshot
+	memcpy(snapshot->approveTransactionLineBuffer, approveTransactionLineBuffer, sizeof(snapshot->approveTransactionLineBuffer));
+
+	// Copy sign challenge line buffer into the snapshot
+	memcpy(snapshot->signChallengeLineBuffer, signChallengeLineBuffer, sizeof(snapshot->signChallengeLineBuffer));
+
+	// Copy amount line buffer into the snapshot
+	memcpy(snapshot->amountLineBuffer, amountLineBuffer, sizeof(snapshot->amountLineBuffer));
+
+	// Copy address type line buffer into the snapshot
+	memcpy(snapshot->addressTypeLineBuffer, addressTypeLineBuffer, sizeof(snapshot->addressTypeLineBuffer));
+
+	// Copy fee line buffer into the snapshot
+	memcpy(snapshot->feeLineBuffer, feeLineBuffer, sizeof(snapshot->feeLineBuffer));
+
+	// Copy kernel features line buffer into the snapshot
+	memcpy(snapshot->kernelFeaturesLineBuffer, kernelFeaturesLineBuffer, sizeof(snapshot->kernelFeaturesLineBuffer));
+
+	// Copy kernel features details title line buffer into the snapshot
+	memcpy(snapshot->kernelFeaturesDetailsTitleLineBuffer, kernelFeaturesDetailsTitleLineBuffer, sizeof(snapshot->kernelFeaturesDetailsTitleLineBuffer));
+
+	// Copy kernel features details text line buffer into the snapshot
+	memcpy(snapshot->kernelFeaturesDetailsTextLineBuffer, kernelFeaturesDetailsTextLineBuffer, sizeof(snapshot->kernelFeaturesDetailsTextLineBuffer));
+
+	// Copy account index line buffer into the snapshot
+	memcpy(snapshot->accountIndexLineBuffer, accountIndexLineBuffer, sizeof(snapshot->accountIndexLineBuffer));
+
+// Check if has NBGL
+#ifdef HAVE_NBGL
+
+	// Copy succeeded line buffer into the snapshot
+	memcpy(snapshot->succeededLineBuffer, succeededLineBuffer, sizeof(snapshot->succeededLineBuffer));
+
+	// Copy failed line buffer into the snapshot
+	memcpy(snapshot->failedLineBuffer, failedLineBuffer, sizeof(snapshot->failedLineBuffer));
+
+	// Copy canceled line buffer into the snapshot
+	memcpy(snapshot->canceledLineBuffer, canceledLineBuffer, sizeof(snapshot->canceledLineBuffer));
+
+	// Copy cancel prompt line buffer into the snapshot
+	memcpy(snapshot->cancelPromptLineBuffer, cancelPromptLineBuffer, sizeof(snapshot->cancelPromptLineBuffer));
+
+	// Copy approve button line buffer into the snapshot
+	memcpy(snapshot->approveButtonLineBuffer, approveButtonLineBuffer, sizeof(snapshot->approveButtonLineBuffer));
+
+	// Copy warning line buffer into the snapshot
+	memcpy(snapshot->warningLineBuffer, warningLineBuffer, sizeof(snapshot->warningLineBuffer));
+#endif
+}
+
+// Restore snapshot
+void restoreSnapshot(const struct Snapshot *snapshot) {
+
+	// Copy snapshot into the transaction
+	memcpy(&transaction, &snapshot->transaction, sizeof(snapshot->transaction));
+
+	// Copy snapshot into the transaction exports
+	memcpy(&transactionExports, &snapshot->transactionExports, sizeof(snapshot->transactionExports));
+
+	// Copy snapshot into the slate
+	memcpy(&slate, &snapshot->slate, sizeof(snapshot->slate));
+
+	// Copy snapshot into the commitments
+	memcpy(&commitments, &snapshot->commitments, sizeof(snapshot->commitments));
+
+	// Copy snapshot into the shared secret cache
+	memcpy(&sharedSecretCache, &snapshot->sharedSecretCache, sizeof(snapshot->sharedSecretCache));
+
+	// Copy snapshot into the root public key cache
+	memcpy(&rootPublicKeyCache, &snapshot->rootPublicKeyCache, sizeof(snapshot->rootPublicKeyCache));
+
+	// Copy snapshot into the chained APDU
+	memcpy(&chainedApdu, &snapshot->chainedApdu, sizeof(snapshot->chainedApdu));
+
+	// Copy snapshot into the persistent storage
+	memcpy(&N_PERSISTENTSTORAGE, &snapshot->persistentStorage, sizeof(snapshot->persistentStorage));
+
+	// Copy snapshot into the IO APDU buffer
+	memcpy(G_io_apdu_buffer, snapshot->ioApduBuffer, sizeof(snapshot->ioApduBuffer));
+
+	// Copy snapshot into the time line buffer
+	memcpy(timeLineBuffer, snapshot->timeLineBuffer, sizeof(snapshot->timeLineBuffer));
+
+	// Copy snapshot into the progress bar message line buffer
+	memcpy(progressBarMessageLineBuffer, snapshot->progressBarMessageLineBuffer, sizeof(snapshot->progressBarMessageLineBuffer));
+
+	// Copy snapshot into the public key line buffer
+	memcpy((char *)publicKeyLineBuffer, snapshot->publicKeyLineBuffer, sizeof(snapshot->publicKeyLineBuffer));
+
+	// Copy snapshot into the address line buffer
+	memcpy(addressLineBuffer, snapshot->addressLineBuffer, sizeof(snapshot->addressLineBuffer));
+
+	// Copy snapshot into the verify address line buffer
+	memcpy(verifyAddressLineBuffer, snapshot->verifyAddressLineBuffer, sizeof(snapshot->verifyAddressLineBuffer));
+
+	// Copy snapshot into the approve transaction line buffer
+	memcpy(approveTransactionLineBuffer, snapshot->approveTransactionLineBuffer, sizeof(snapshot->approveTransactionLineBuffer));
+
+	// Copy snapshot into the sign challenge line buffer
+	memcpy(signChallengeLineBuffer, snapshot->signChallengeLineBuffer, sizeof(snapshot->signChallengeLineBuffer));
+
+	// Copy snapshot into the amount line buffer
+	memcpy(amountLineBuffer, snapshot->amountLineBuffer, sizeof(snapshot->amountLineBuffer));
+
+	// Copy snapshot into the address type line buffer
+	memcpy(addressTypeLineBuffer, snapshot->addressTypeLineBuffer, sizeof(snapshot->addressTypeLineBuffer));
+
+	// Copy snapshot into the fee line buffer
+	memcpy(feeLineBuffer, snapshot->feeLineBuffer, sizeof(snapshot->feeLineBuffer));
+
+	// Copy snapshot into the kernel features line buffer
+	memcpy(kernelFeaturesLineBuffer, snapshot->kernelFeaturesLineBuffer, sizeof(snapshot->kernelFeaturesLineBuffer));
+
+	// Copy snapshot into the kernel features details title line buffer
+	memcpy(kernelFeaturesDetailsTitleLineBuffer, snapshot->kernelFeaturesDetailsTitleLineBuffer, sizeof(snapshot->kernelFeaturesDetailsTitleLineBuffer));
+
+	// Copy snapshot into the kernel features details text line buffer
+	memcpy(kernelFeaturesDetailsTextLineBuffer, snapshot->kernelFeaturesDetailsTextLineBuffer, sizeof(snapshot->kernelFeaturesDetailsTextLineBuffer));
+
+	// Copy snapshot into the account index line buffer
+	memcpy(accountIndexLineBuffer, snapshot->accountIndexLineBuffer, sizeof(snapshot->accountIndexLineBuffer));
+
+// Check if has NBGL
+#ifdef HAVE_NBGL
+
+	// Copy snapshot into the succeeded line buffer
+	memcpy(succeededLineBuffer, snapshot->succeededLineBuffer, sizeof(snapshot->succeededLineBuffer));
+
+	// Copy snapshot into the failed line buffer
+	memcpy(failedLineBuffer, snapshot->failedLineBuffer, sizeof(snapshot->failedLineBuffer));
+
+	// Copy snapshot into the canceled line buffer
+	memcpy(canceledLineBuffer, snapshot->canceledLineBuffer, sizeof(snapshot->canceledLineBuffer));
+
+	// Copy snapshot into the cancel prompt line buffer
+	memcpy(cancelPromptLineBuffer, snapshot->cancelPromptLineBuffer, sizeof(snapshot->cancelPromptLineBuffer));
+
+	// Copy snapshot into the approve button line buffer
+	memcpy(approveButtonLineBuffer, snapshot->approveButtonLineBuffer, sizeof(snapshot->approveButtonLineBuffer));
+
+	// Copy snapshot into the warning line buffer
+	memcpy(warningLineBuffer, snapshot->warningLineBuffer, sizeof(snapshot->warningLineBuffer));
+#endif
+}
+
+#endif
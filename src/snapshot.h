@@ -0,0 +1,131 @@
+// Header guard
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+
+// Check if fuzzing
+#ifdef FUZZING
+
+// Header files
+#include "commitments.h"
+#include "common.h"
+#include "menus.h"
+#include "root_public_key_cache.h"
+#include "shared_secret_cache.h"
+#include "slate.h"
+#include "storage.h"
+#include "transaction.h"
+
+
+// Structures
+
+// Snapshot
+struct Snapshot {
+
+	// Transaction
+	struct Transaction transaction;
+
+	// Transaction exports
+	struct TransactionExports transactionExports;
+
+	// Slate
+	struct Slate slate;
+
+	// Commitments
+	struct Commitments commitments;
+
+	// Shared secret cache
+	struct SharedSecretCache sharedSecretCache;
+
+	// Root public key cache
+	struct RootPublicKeyCache rootPublicKeyCache;
+
+	// Chained APDU
+	struct ChainedApdu chainedApdu;
+
+	// Persistent storage
+	struct PersistentStorage persistentStorage;
+
+	// IO APDU buffer
+	unsigned char ioApduBuffer[IO_APDU_BUFFER_SIZE];
+
+	// Time line buffer
+	char timeLineBuffer[TIME_LINE_BUFFER_SIZE];
+
+	// Progress bar message line buffer
+	char progressBarMessageLineBuffer[PROGRESS_BAR_MESSAGE_LINE_BUFFER_SIZE];
+
+	// Public key line buffer
+	char publicKeyLineBuffer[PUBLIC_KEY_LINE_BUFFER_SIZE];
+
+	// Address line buffer
+	char addressLineBuffer[ADDRESS_LINE_BUFFER_SIZE];
+
+	// Verify address line buffer
+	char verifyAddressLineBuffer[VERIFY_ADDRESS_LINE_BUFFER_SIZE];
+
+	// Approve transaction line buffer
+	char approveTransactionLineBuffer[APPROVE_TRANSACTION_LINE_BUFFER_SIZE];
+
+	// Sign challenge line buffer
+	char signChallengeLineBuffer[SIGN_CHALLENGE_LINE_BUFFER_SIZE];
+
+	// Amount line buffer
+	char amountLineBuffer[AMOUNT_LINE_BUFFER_SIZE];
+
+	// Address type line buffer
+	char addressTypeLineBuffer[ADDRESS_TYPE_LINE_BUFFER_SIZE];
+
+	// Fee line buffer
+	char feeLineBuffer[FEE_LINE_BUFFER_SIZE];
+
+	// Kernel features line buffer
+	char kernelFeaturesLineBuffer[KERNEL_FEATURES_LINE_BUFFER_SIZE];
+
+	// Kernel features details title line buffer
+	char kernelFeaturesDetailsTitleLineBuffer[KERNEL_FEATURES_DETAILS_TITLE_LINE_BUFFER_SIZE];
+
+	// Kernel features details text line buffer
+	char kernelFeaturesDetailsTextLineBuffer[KERNEL_FEATURES_DETAILS_TEXT_LINE_BUFFER_SIZE];
+
+	// Account index line buffer
+	char accountIndexLineBuffer[ACCOUNT_INDEX_LINE_BUFFER_SIZE];
+
+// Check if has NBGL
+#ifdef HAVE_NBGL
+
+	// Succeeded line buffer
+	char succeededLineBuffer[SUCCEEDED_LINE_BUFFER_SIZE];
+
+	// Failed line buffer
+	char failedLineBuffer[FAILED_LINE_BUFFER_SIZE];
+
+	// Canceled line buffer
+	char canceledLineBuffer[CANCELED_LINE_BUFFER_SIZE];
+
+	// Cancel prompt line buffer
+	char cancelPromptLineBuffer[CANCEL_PROMPT_LINE_BUFFER_SIZE];
+
+	// Approve button line buffer
+	char approveButtonLineBuffer[APPROVE_BUTTON_LINE_BUFFER_SIZE];
+
+	// Warning line buffer
+	char warningLineBuffer[WARNING_LINE_BUFFER];
+
+#endif
+};
+
+
+// Function prototypes
+
+// Take snapshot
+void takeSnapshot(struct Snapshot *snapshot);
+
+// Restore snapshot
+void restoreSnapshot(const struct Snapshot *snapshot);
+
+
+#endif
+
+
+#endif
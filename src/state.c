@@ -1,4 +1,6 @@
 // Header files
+#include "commitments.h"
+#include "shared_secret_cache.h"
 #include "slate.h"
 #include "state.h"
 #include "transaction.h"
@@ -14,6 +16,12 @@ void resetState(void) {
 
 	// Reset slate
 	resetSlate();
+
+	// Reset commitments
+	resetCommitments();
+
+	// Reset shared secret cache
+	resetSharedSecretCache();
 }
 
 // Reset unrelated state
@@ -31,6 +39,19 @@ void resetUnrelatedState(const enum Instruction instruction) {
 		case CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION:
 		case CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION:
 		case FINISH_TRANSACTION_INSTRUCTION:
+		case EXPORT_TRANSACTION_INSTRUCTION:
+		case IMPORT_TRANSACTION_INSTRUCTION:
+
+		// Slate related instruction
+		case START_ENCRYPTING_SLATE_INSTRUCTION:
+		case CONTINUE_ENCRYPTING_SLATE_INSTRUCTION:
+		case FINISH_ENCRYPTING_SLATE_INSTRUCTION:
+		case START_DECRYPTING_SLATE_INSTRUCTION:
+		case CONTINUE_DECRYPTING_SLATE_INSTRUCTION:
+		case FINISH_DECRYPTING_SLATE_INSTRUCTION:
+
+		// Batch instruction
+		case BATCH_INSTRUCTION:
 
 			// Break
 			break;
@@ -56,6 +77,21 @@ void resetUnrelatedState(const enum Instruction instruction) {
 		case CONTINUE_DECRYPTING_SLATE_INSTRUCTION:
 		case FINISH_DECRYPTING_SLATE_INSTRUCTION:
 
+		// Transaction related instruction
+		case START_TRANSACTION_INSTRUCTION:
+		case CONTINUE_TRANSACTION_INCLUDE_OUTPUT_INSTRUCTION:
+		case CONTINUE_TRANSACTION_INCLUDE_INPUT_INSTRUCTION:
+		case CONTINUE_TRANSACTION_APPLY_OFFSET_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_PUBLIC_KEY_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION:
+		case CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION:
+		case FINISH_TRANSACTION_INSTRUCTION:
+		case EXPORT_TRANSACTION_INSTRUCTION:
+		case IMPORT_TRANSACTION_INSTRUCTION:
+
+		// Batch instruction
+		case BATCH_INSTRUCTION:
+
 			// Break
 			break;
 
@@ -68,4 +104,27 @@ void resetUnrelatedState(const enum Instruction instruction) {
 			// Break
 			break;
 	}
+
+	// Check instruction
+	switch(instruction) {
+
+		// Commitments related instruction
+		case START_GETTING_COMMITMENTS_INSTRUCTION:
+		case CONTINUE_GETTING_COMMITMENTS_INSTRUCTION:
+
+		// Batch instruction
+		case BATCH_INSTRUCTION:
+
+			// Break
+			break;
+
+		// Default
+		default:
+
+			// Reset commitments
+			resetCommitments();
+
+			// Break
+			break;
+	}
 }
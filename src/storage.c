@@ -1,5 +1,6 @@
 // Header files
 #include "common.h"
+#include "performance_counters.h"
 #include "storage.h"
 
 
@@ -9,7 +10,7 @@
 #ifdef FUZZING
 
 // Persistent storage
-struct PersistentStorage N_PERSISTENTSTORAGE;
+SESSION_LOCAL struct PersistentStorage N_PERSISTENTSTORAGE;
 
 // Otherwise
 #else
@@ -25,10 +26,60 @@ const struct PersistentStorage N_PERSISTENTSTORAGE;
 // Initialize storage
 void initializeStorage(void) {
 
-	// Check if current transaction secret nonce index is invalid
-	if(storage.currentTransactionSecretNonceIndex >= NUMBER_OF_TRANSACTION_SECRET_NONCES) {
+	// Go through all transaction secret nonce records
+	for(size_t i = 0; i < NUMBER_OF_TRANSACTION_SECRET_NONCES; ++i) {
 
-		// Clear current transaction secret nonce index
-		nvm_write((void *)&storage.currentTransactionSecretNonceIndex, NULL, sizeof(storage.currentTransactionSecretNonceIndex));
+		// Check if transaction secret nonce record's sequence number doesn't belong at its index
+		const uint32_t sequenceNumber = storage.transactionSecretNonceRecords[i].sequenceNumber;
+		if(sequenceNumber && getTransactionSecretNonceRecordIndex(sequenceNumber) != i) {
+
+			// Clear transaction secret nonce record
+			writeStorage(&storage.transactionSecretNonceRecords[i], NULL, sizeof(storage.transactionSecretNonceRecords[i]));
+		}
+	}
+}
+
+// Get current transaction secret nonce sequence number
+uint32_t getCurrentTransactionSecretNonceSequenceNumber(void) {
+
+	// Go through all transaction secret nonce records
+	uint32_t currentSequenceNumber = 0;
+	for(size_t i = 0; i < NUMBER_OF_TRANSACTION_SECRET_NONCES; ++i) {
+
+		// Check if transaction secret nonce record's sequence number belongs at its index and is the newest
+		const uint32_t sequenceNumber = storage.transactionSecretNonceRecords[i].sequenceNumber;
+		if(sequenceNumber && getTransactionSecretNonceRecordIndex(sequenceNumber) == i && sequenceNumber > currentSequenceNumber) {
+
+			// Set current sequence number to the transaction secret nonce record's sequence number
+			currentSequenceNumber = sequenceNumber;
+		}
 	}
+
+	// Return current sequence number
+	return currentSequenceNumber;
 }
+
+// Get transaction secret nonce record index
+size_t getTransactionSecretNonceRecordIndex(const uint32_t sequenceNumber) {
+
+	// Return index of the transaction secret nonce record that the sequence number is stored in
+	return (sequenceNumber - 1) % NUMBER_OF_TRANSACTION_SECRET_NONCES;
+}
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+// Write storage
+void writeStorage(volatile void *destination, const void *source, const size_t length) {
+
+	// Start NVM write performance counter with cleanup
+	START_PERFORMANCE_COUNTER_WITH_CLEANUP(NVM_WRITE_PERFORMANCE_STAGE, 0);
+
+	// Write source to the destination in storage or clear the destination if no source is provided
+	nvm_write((void *)destination, (void *)source, length);
+
+	// Stop NVM write performance counter with cleanup
+	STOP_PERFORMANCE_COUNTER_WITH_CLEANUP(NVM_WRITE_PERFORMANCE_STAGE);
+}
+
+#endif
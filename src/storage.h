@@ -13,19 +13,33 @@
 #define storage (*(volatile struct PersistentStorage *)PIC(&N_PERSISTENTSTORAGE))
 
 // Number of transaction secret nonces
-#define NUMBER_OF_TRANSACTION_SECRET_NONCES 20
+#define NUMBER_OF_TRANSACTION_SECRET_NONCES 32
+
+// Encrypted transaction secret nonce size
+#define ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE (sizeof(transaction.secretNonce) + ((sizeof(transaction.secretNonce) % CX_AES_BLOCK_SIZE) ? CX_AES_BLOCK_SIZE - sizeof(transaction.secretNonce) % CX_AES_BLOCK_SIZE : CX_AES_BLOCK_SIZE))
+
+// Transaction secret nonce record alignment
+#define TRANSACTION_SECRET_NONCE_RECORD_ALIGNMENT 64
 
 
 // Structures
 
+// Transaction secret nonce record
+struct TransactionSecretNonceRecord {
+
+	// Sequence number
+	uint32_t sequenceNumber;
+
+	// Encrypted secret nonce
+	uint8_t encryptedSecretNonce[ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE];
+
+} __attribute__((aligned(TRANSACTION_SECRET_NONCE_RECORD_ALIGNMENT)));
+
 // Persistent storage
 struct PersistentStorage {
 
-	// Transaction secret nonces
-	uint8_t transactionSecretNonces[NUMBER_OF_TRANSACTION_SECRET_NONCES][sizeof(transaction.secretNonce) + ((sizeof(transaction.secretNonce) % CX_AES_BLOCK_SIZE) ? CX_AES_BLOCK_SIZE - sizeof(transaction.secretNonce) % CX_AES_BLOCK_SIZE : CX_AES_BLOCK_SIZE)];
-
-	// Current transaction secret nonce index
-	uint8_t currentTransactionSecretNonceIndex;
+	// Transaction secret nonce records
+	struct TransactionSecretNonceRecord transactionSecretNonceRecords[NUMBER_OF_TRANSACTION_SECRET_NONCES];
 };
 
 
@@ -35,7 +49,7 @@ struct PersistentStorage {
 #ifdef FUZZING
 
 // Persistent storage
-extern struct PersistentStorage N_PERSISTENTSTORAGE;
+extern SESSION_LOCAL struct PersistentStorage N_PERSISTENTSTORAGE;
 
 // Otherwise
 #else
@@ -51,5 +65,25 @@ extern const struct PersistentStorage N_PERSISTENTSTORAGE;
 // Initialize storage
 void initializeStorage(void);
 
+// Get current transaction secret nonce sequence number
+uint32_t getCurrentTransactionSecretNonceSequenceNumber(void);
+
+// Get transaction secret nonce record index
+size_t getTransactionSecretNonceRecordIndex(const uint32_t sequenceNumber);
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+// Write storage
+void writeStorage(volatile void *destination, const void *source, const size_t length);
+
+// Otherwise
+#else
+
+// Write storage
+#define writeStorage(destination, source, length) nvm_write((void *)(destination), (void *)(source), (length))
+
+#endif
+
 
 #endif
@@ -43,20 +43,14 @@ bool getPublicKeyFromTorAddress(cx_ecfp_public_key_t *publicKey, const char *tor
 		return false;
 	}
 
-	// Get decoded Tor address length
-	const size_t decodedTorAddressLength = getBase32DecodedLength(torAddress, length);
-
-	// Check if decoded Tor address length is invalid
-	if(decodedTorAddressLength != ED25519_PUBLIC_KEY_SIZE + ADDRESS_CHECKSUM_SIZE + ADDRESS_VERSION_SIZE) {
+	// Check if decoding Tor address failed or its length is invalid
+	uint8_t decodedTorAddress[ED25519_PUBLIC_KEY_SIZE + ADDRESS_CHECKSUM_SIZE + ADDRESS_VERSION_SIZE];
+	if(base32Decode(decodedTorAddress, sizeof(decodedTorAddress), torAddress, length) != sizeof(decodedTorAddress)) {
 
 		// Return false
 		return false;
 	}
 
-	// Decode Tor address
-	uint8_t decodedTorAddress[ED25519_PUBLIC_KEY_SIZE + ADDRESS_CHECKSUM_SIZE + ADDRESS_VERSION_SIZE];
-	base32Decode(decodedTorAddress, torAddress, length);
-
 	// Check if decoded Tor address's version is invalid
 	if(decodedTorAddress[ED25519_PUBLIC_KEY_SIZE + ADDRESS_CHECKSUM_SIZE] != ADDRESS_VERSION) {
 
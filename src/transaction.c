@@ -8,7 +8,25 @@
 // Global variables
 
 // Transaction
-struct Transaction transaction;
+SESSION_LOCAL struct Transaction transaction;
+
+// Transaction exports
+SESSION_LOCAL struct TransactionExports transactionExports;
+
+
+// Function prototypes
+
+// Get public key from scalar
+static void getPublicKeyFromScalar(uint8_t *publicKey, const volatile uint8_t *scalar, const size_t scalarLength);
+
+// Serialize transaction context
+static void serializeTransactionContext(volatile uint8_t *context);
+
+// Deserialize transaction context
+static void deserializeTransactionContext(const volatile uint8_t *context);
+
+// Get transaction export nonce
+static void getTransactionExportNonce(uint8_t *nonce, const uint64_t counter);
 
 
 // Supporting function implementation
@@ -23,36 +41,55 @@ void resetTransaction(void) {
 // Create and save transaction secret nonce
 void createAndSaveTransactionSecretNonce(void) {
 
-	// Create transaction's secret nonce
-	createSingleSignerNonces((uint8_t *)transaction.secretNonce, NULL);
+	// Create transaction's secret nonce and public nonce
+	createSingleSignerNonces((uint8_t *)transaction.secretNonce, transaction.publicNonce);
+
+	// Set that transaction's public nonce is cached
+	transaction.publicNonceCached = true;
+
+	// Get current transaction secret nonce sequence number from storage
+	const uint32_t currentSequenceNumber = getCurrentTransactionSecretNonceSequenceNumber();
+
+	// Check if sequence numbers are exhausted
+	if(currentSequenceNumber == UINT32_MAX) {
+
+		// Throw internal error error
+		THROW(INTERNAL_ERROR_ERROR);
+	}
+
+	// Create transaction secret nonce record with the next sequence number
+	struct TransactionSecretNonceRecord record = {
+		.sequenceNumber = currentSequenceNumber + 1
+	};
 
 	// Encrypt the transaction's secret nonce with the transaction's blinding factor
-	uint8_t encryptedSecretNonce[sizeof(storage.transactionSecretNonces[storage.currentTransactionSecretNonceIndex])];
-	encryptData(encryptedSecretNonce, (uint8_t *)transaction.secretNonce, sizeof(transaction.secretNonce), (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor));
+	encryptData(record.encryptedSecretNonce, (uint8_t *)transaction.secretNonce, sizeof(transaction.secretNonce), (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor));
 
 	// Check if encrypted secret nonce is invalid
-	if(isZeroArraySecure(encryptedSecretNonce, sizeof(encryptedSecretNonce))) {
+	if(isZeroArraySecure(record.encryptedSecretNonce, sizeof(record.encryptedSecretNonce))) {
 
 		// Throw internal error error
 		THROW(INTERNAL_ERROR_ERROR);
 	}
 
-	// Store encrypted secret nonce in storage at the current transaction secret nonce index
-	nvm_write((void *)storage.transactionSecretNonces[storage.currentTransactionSecretNonceIndex], (void *)encryptedSecretNonce, sizeof(encryptedSecretNonce));
+	// Get transaction secret nonce record's index from its sequence number
+	const size_t index = getTransactionSecretNonceRecordIndex(record.sequenceNumber);
+
+	// Store transaction secret nonce record in storage at its index
+	writeStorage(&storage.transactionSecretNonceRecords[index], &record, sizeof(record));
 
 	// Set transaction's secret nonce index
-	transaction.secretNonceIndex = storage.currentTransactionSecretNonceIndex + 1;
+	transaction.secretNonceIndex = index + 1;
 
-	// Increment current transaction secret nonce index in storage
-	const uint8_t nextTransactionSecretNonceIndex = (storage.currentTransactionSecretNonceIndex + 1) % NUMBER_OF_TRANSACTION_SECRET_NONCES;
-	nvm_write((void *)&storage.currentTransactionSecretNonceIndex, (void *)&nextTransactionSecretNonceIndex, sizeof(nextTransactionSecretNonceIndex));
+	// Set transaction's secret nonce sequence number
+	transaction.secretNonceSequenceNumber = record.sequenceNumber;
 }
 
 // Restore transaction secret nonce
 void restoreTransactionSecretNonce(void) {
 
 	// Initialize secret nonce
-	volatile uint8_t secretNonce[sizeof(storage.transactionSecretNonces[transaction.secretNonceIndex - 1])];
+	volatile uint8_t secretNonce[sizeof(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce)];
 
 	// Begin try
 	BEGIN_TRY {
@@ -61,7 +98,7 @@ void restoreTransactionSecretNonce(void) {
 		TRY {
 
 			// Decrypt the secret nonce in storage at the transaction's secret nonce index with the transaction's blinding factor
-			const size_t secretNonceLength = decryptData(secretNonce, (uint8_t *)storage.transactionSecretNonces[transaction.secretNonceIndex - 1], sizeof(storage.transactionSecretNonces[transaction.secretNonceIndex - 1]), (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor));
+			const size_t secretNonceLength = decryptData(secretNonce, (uint8_t *)storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce, sizeof(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce), (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor));
 
 			// Check if secret nonce length is invalid
 			if(secretNonceLength != sizeof(transaction.secretNonce)) {
@@ -70,6 +107,9 @@ void restoreTransactionSecretNonce(void) {
 				THROW(INTERNAL_ERROR_ERROR);
 			}
 
+			// Set that transaction's public nonce isn't cached
+			transaction.publicNonceCached = false;
+
 			// Set transaction's secret nonce
 			memcpy((uint8_t *)transaction.secretNonce, (uint8_t *)secretNonce, secretNonceLength);
 		}
@@ -89,6 +129,386 @@ void restoreTransactionSecretNonce(void) {
 // Clear transaction secret nonce
 void clearTransactionSecretNonce(void) {
 
-	// Clear encrypted secret nonce in storage at the transaction's secret nonce index
-	nvm_write((void *)storage.transactionSecretNonces[transaction.secretNonceIndex - 1], NULL, sizeof(storage.transactionSecretNonces[transaction.secretNonceIndex - 1]));
+	// Clear encrypted secret nonce in storage at the transaction's secret nonce index while keeping the record's sequence number
+	writeStorage(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce, NULL, sizeof(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce));
+}
+
+// Get transaction public key
+const uint8_t *getTransactionPublicKey(void) {
+
+	// Check if transaction's public key isn't cached
+	if(!transaction.publicKeyCached) {
+
+		// Get transaction's public key from the transaction's blinding factor
+		getPublicKeyFromScalar(transaction.publicKey, transaction.blindingFactor, sizeof(transaction.blindingFactor));
+
+		// Set that transaction's public key is cached
+		transaction.publicKeyCached = true;
+	}
+
+	// Return transaction's public key
+	return transaction.publicKey;
+}
+
+// Get transaction public nonce
+const uint8_t *getTransactionPublicNonce(void) {
+
+	// Check if transaction's public nonce isn't cached
+	if(!transaction.publicNonceCached) {
+
+		// Get transaction's public nonce from the transaction's secret nonce
+		getPublicKeyFromScalar(transaction.publicNonce, transaction.secretNonce, sizeof(transaction.secretNonce));
+
+		// Set that transaction's public nonce is cached
+		transaction.publicNonceCached = true;
+	}
+
+	// Return transaction's public nonce
+	return transaction.publicNonce;
+}
+
+// Export transaction
+void exportTransaction(uint8_t *exportedTransaction) {
+
+	// Check if transaction export key hasn't been created
+	if(!transactionExports.keyCreated) {
+
+		// Create random transaction export key
+		cx_rng((uint8_t *)transactionExports.key, sizeof(transactionExports.key));
+
+		// Set that transaction export key has been created
+		transactionExports.keyCreated = true;
+	}
+
+	// Check if transaction export counter will overflow
+	if(transactionExports.counter == UINT64_MAX) {
+
+		// Throw internal error error
+		THROW(INTERNAL_ERROR_ERROR);
+	}
+
+	// Increment transaction export counter
+	const uint64_t counter = ++transactionExports.counter;
+
+	// Set that the counter is pending and expire the counter that previously used its bit
+	transactionExports.pendingCounters |= (uint64_t)1 << (counter % MAXIMUM_NUMBER_OF_EXPORTED_TRANSACTIONS);
+
+	// Set exported transaction's counter
+	memcpy(exportedTransaction, &counter, sizeof(counter));
+
+	// Initialize context
+	volatile uint8_t context[TRANSACTION_CONTEXT_SIZE];
+
+	// Initialize ChaCha20 Poly1305 state
+	volatile ChaCha20Poly1305State chaCha20Poly1305State;
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Serialize the transaction's context
+			serializeTransactionContext(context);
+
+			// Get nonce from the counter
+			uint8_t nonce[CHACHA20_NONCE_SIZE];
+			getTransactionExportNonce(nonce, counter);
+
+			// Initialize ChaCha20 Poly1305 state with the transaction export key and nonce
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, (uint8_t *)transactionExports.key, nonce, NULL, 0, 0, NULL);
+
+			// Encrypt the context into the exported transaction
+			encryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&chaCha20Poly1305State, &exportedTransaction[sizeof(counter)], (uint8_t *)context, sizeof(context));
+
+			// Append tag to the exported transaction
+			getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&chaCha20Poly1305State, &exportedTransaction[sizeof(counter) + sizeof(context)]);
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the context
+			explicit_bzero((uint8_t *)context, sizeof(context));
+
+			// Clear the ChaCha20 Poly1305 state
+			explicit_bzero((ChaCha20Poly1305State *)&chaCha20Poly1305State, sizeof(chaCha20Poly1305State));
+		}
+	}
+
+	// End try
+	END_TRY;
+
+	// Reset the transaction so that it can only be continued by importing it
+	resetTransaction();
+}
+
+// Import transaction
+void importTransaction(const uint8_t *exportedTransaction) {
+
+	// Get counter from the exported transaction
+	uint64_t counter;
+	memcpy(&counter, exportedTransaction, sizeof(counter));
+
+	// Check if transaction export key hasn't been created or the counter isn't pending
+	if(!transactionExports.keyCreated || !counter || counter > transactionExports.counter || transactionExports.counter - counter >= MAXIMUM_NUMBER_OF_EXPORTED_TRANSACTIONS || !(transactionExports.pendingCounters & ((uint64_t)1 << (counter % MAXIMUM_NUMBER_OF_EXPORTED_TRANSACTIONS)))) {
+
+		// Throw invalid parameters error
+		THROW(INVALID_PARAMETERS_ERROR);
+	}
+
+	// Initialize context
+	volatile uint8_t context[TRANSACTION_CONTEXT_SIZE];
+
+	// Initialize ChaCha20 Poly1305 state
+	volatile ChaCha20Poly1305State chaCha20Poly1305State;
+
+	// Initialize expected tag
+	volatile uint8_t expectedTag[POLY1305_TAG_SIZE];
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Get nonce from the counter
+			uint8_t nonce[CHACHA20_NONCE_SIZE];
+			getTransactionExportNonce(nonce, counter);
+
+			// Initialize ChaCha20 Poly1305 state with the transaction export key and nonce
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, (uint8_t *)transactionExports.key, nonce, NULL, 0, 0, NULL);
+
+			// Decrypt the exported transaction's encrypted context into the context
+			decryptChaCha20Poly1305Data((ChaCha20Poly1305State *)&chaCha20Poly1305State, context, &exportedTransaction[sizeof(counter)], sizeof(context));
+
+			// Get ChaCha20 Poly1305 expected tag
+			getChaCha20Poly1305Tag((ChaCha20Poly1305State *)&chaCha20Poly1305State, expectedTag);
+
+			// Check if the exported transaction's tag isn't equal to the expected tag
+			if(os_secure_memcmp((uint8_t *)&exportedTransaction[sizeof(counter) + sizeof(context)], (uint8_t *)expectedTag, sizeof(expectedTag))) {
+
+				// Throw invalid parameters error
+				THROW(INVALID_PARAMETERS_ERROR);
+			}
+
+			// Set that the counter is no longer pending so that the exported transaction can't be imported again
+			transactionExports.pendingCounters &= ~((uint64_t)1 << (counter % MAXIMUM_NUMBER_OF_EXPORTED_TRANSACTIONS));
+
+			// Deserialize the transaction's context
+			deserializeTransactionContext(context);
+
+			// Check if transaction is sending and it has a secret nonce
+			if(transaction.send && transaction.secretNonceIndex) {
+
+				// Check if the transaction's secret nonce record was reused or its secret nonce was cleared since the transaction was exported
+				if(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].sequenceNumber != transaction.secretNonceSequenceNumber || isZeroArraySecure((uint8_t *)storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce, sizeof(storage.transactionSecretNonceRecords[transaction.secretNonceIndex - 1].encryptedSecretNonce))) {
+
+					// Reset the transaction
+					resetTransaction();
+
+					// Throw invalid parameters error
+					THROW(INVALID_PARAMETERS_ERROR);
+				}
+
+				// Check if transaction's offset was applied
+				if(transaction.offsetApplied) {
+
+					// Restore transaction secret nonce
+					restoreTransactionSecretNonce();
+				}
+			}
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the context
+			explicit_bzero((uint8_t *)context, sizeof(context));
+
+			// Clear the ChaCha20 Poly1305 state
+			explicit_bzero((ChaCha20Poly1305State *)&chaCha20Poly1305State, sizeof(chaCha20Poly1305State));
+
+			// Clear the expected tag
+			explicit_bzero((uint8_t *)expectedTag, sizeof(expectedTag));
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Get public key from scalar
+void getPublicKeyFromScalar(uint8_t *publicKey, const volatile uint8_t *scalar, const size_t scalarLength) {
+
+	// Initialize private key
+	volatile cx_ecfp_private_key_t privateKey;
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Get private key from the scalar and throw error if it fails
+			CX_THROW(cx_ecfp_init_private_key_no_throw(CX_CURVE_SECP256K1, (uint8_t *)scalar, scalarLength, (cx_ecfp_private_key_t *)&privateKey));
+
+			// Get public key from the private key
+			getPublicKeyFromPrivateKey(publicKey, (cx_ecfp_private_key_t *)&privateKey);
+		}
+
+		// Finally
+		FINALLY {
+
+			// Clear the private key
+			explicit_bzero((cx_ecfp_private_key_t *)&privateKey, sizeof(privateKey));
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Serialize transaction context
+void serializeTransactionContext(volatile uint8_t *context) {
+
+	// Append account to the context
+	memcpy((uint8_t *)context, &transaction.account, sizeof(transaction.account));
+	context += sizeof(transaction.account);
+
+	// Append index to the context
+	memcpy((uint8_t *)context, &transaction.index, sizeof(transaction.index));
+	context += sizeof(transaction.index);
+
+	// Append send to the context
+	memcpy((uint8_t *)context, &transaction.send, sizeof(transaction.send));
+	context += sizeof(transaction.send);
+
+	// Append receive to the context
+	memcpy((uint8_t *)context, &transaction.receive, sizeof(transaction.receive));
+	context += sizeof(transaction.receive);
+
+	// Append fee to the context
+	memcpy((uint8_t *)context, &transaction.fee, sizeof(transaction.fee));
+	context += sizeof(transaction.fee);
+
+	// Append remaining output to the context
+	memcpy((uint8_t *)context, &transaction.remainingOutput, sizeof(transaction.remainingOutput));
+	context += sizeof(transaction.remainingOutput);
+
+	// Append remaining input to the context
+	memcpy((uint8_t *)context, &transaction.remainingInput, sizeof(transaction.remainingInput));
+	context += sizeof(transaction.remainingInput);
+
+	// Append blinding factor to the context
+	memcpy((uint8_t *)context, (uint8_t *)transaction.blindingFactor, sizeof(transaction.blindingFactor));
+	context += sizeof(transaction.blindingFactor);
+
+	// Check if transaction is sending
+	if(transaction.send) {
+
+		// Append no secret nonce to the context since a sending transaction's secret nonce is restored from storage when it's imported
+		explicit_bzero((uint8_t *)context, sizeof(transaction.secretNonce));
+	}
+
+	// Otherwise
+	else {
+
+		// Append secret nonce to the context
+		memcpy((uint8_t *)context, (uint8_t *)transaction.secretNonce, sizeof(transaction.secretNonce));
+	}
+
+	context += sizeof(transaction.secretNonce);
+
+	// Append secret nonce sequence number to the context
+	memcpy((uint8_t *)context, &transaction.secretNonceSequenceNumber, sizeof(transaction.secretNonceSequenceNumber));
+	context += sizeof(transaction.secretNonceSequenceNumber);
+
+	// Append offset applied to the context
+	*context++ = transaction.offsetApplied;
+
+	// Append message signed to the context
+	*context++ = transaction.messageSigned;
+
+	// Append address length to the context
+	*context++ = transaction.addressLength;
+
+	// Append address to the context
+	memcpy((uint8_t *)context, transaction.address, sizeof(transaction.address));
+}
+
+// Deserialize transaction context
+void deserializeTransactionContext(const volatile uint8_t *context) {
+
+	// Get account from the context
+	memcpy(&transaction.account, (const uint8_t *)context, sizeof(transaction.account));
+	context += sizeof(transaction.account);
+
+	// Get index from the context
+	memcpy(&transaction.index, (const uint8_t *)context, sizeof(transaction.index));
+	context += sizeof(transaction.index);
+
+	// Get send from the context
+	memcpy(&transaction.send, (const uint8_t *)context, sizeof(transaction.send));
+	context += sizeof(transaction.send);
+
+	// Get receive from the context
+	memcpy(&transaction.receive, (const uint8_t *)context, sizeof(transaction.receive));
+	context += sizeof(transaction.receive);
+
+	// Get fee from the context
+	memcpy(&transaction.fee, (const uint8_t *)context, sizeof(transaction.fee));
+	context += sizeof(transaction.fee);
+
+	// Get remaining output from the context
+	memcpy(&transaction.remainingOutput, (const uint8_t *)context, sizeof(transaction.remainingOutput));
+	context += sizeof(transaction.remainingOutput);
+
+	// Get remaining input from the context
+	memcpy(&transaction.remainingInput, (const uint8_t *)context, sizeof(transaction.remainingInput));
+	context += sizeof(transaction.remainingInput);
+
+	// Get blinding factor from the context
+	memcpy((uint8_t *)transaction.blindingFactor, (const uint8_t *)context, sizeof(transaction.blindingFactor));
+	context += sizeof(transaction.blindingFactor);
+
+	// Get secret nonce from the context
+	memcpy((uint8_t *)transaction.secretNonce, (const uint8_t *)context, sizeof(transaction.secretNonce));
+	context += sizeof(transaction.secretNonce);
+
+	// Get secret nonce sequence number from the context
+	memcpy(&transaction.secretNonceSequenceNumber, (const uint8_t *)context, sizeof(transaction.secretNonceSequenceNumber));
+	context += sizeof(transaction.secretNonceSequenceNumber);
+
+	// Set secret nonce index from the secret nonce sequence number
+	transaction.secretNonceIndex = transaction.secretNonceSequenceNumber ? getTransactionSecretNonceRecordIndex(transaction.secretNonceSequenceNumber) + 1 : 0;
+
+	// Get offset applied from the context
+	transaction.offsetApplied = *context++;
+
+	// Get message signed from the context
+	transaction.messageSigned = *context++;
+
+	// Get address length from the context
+	transaction.addressLength = *context++;
+
+	// Get address from the context
+	memcpy(transaction.address, (const uint8_t *)context, sizeof(transaction.address));
+
+	// Set that transaction's public key isn't cached
+	transaction.publicKeyCached = false;
+
+	// Set that transaction's public nonce isn't cached
+	transaction.publicNonceCached = false;
+
+	// Set that transaction has started
+	transaction.started = true;
+}
+
+// Get transaction export nonce
+void getTransactionExportNonce(uint8_t *nonce, const uint64_t counter) {
+
+	// Set nonce to the counter padded with zeros
+	explicit_bzero(nonce, CHACHA20_NONCE_SIZE);
+	memcpy(nonce, &counter, sizeof(counter));
 }
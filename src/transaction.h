@@ -5,10 +5,26 @@
 
 // Header files
 #include <stdbool.h>
+#include "chacha20_poly1305.h"
 #include "crypto.h"
 #include "tor.h"
 
 
+// Definitions
+
+// Transaction context size
+#define TRANSACTION_CONTEXT_SIZE (sizeof(transaction.account) + sizeof(transaction.index) + sizeof(transaction.send) + sizeof(transaction.receive) + sizeof(transaction.fee) + sizeof(transaction.remainingOutput) + sizeof(transaction.remainingInput) + sizeof(transaction.blindingFactor) + sizeof(transaction.secretNonce) + sizeof(transaction.secretNonceSequenceNumber) + sizeof(transaction.offsetApplied) + sizeof(transaction.messageSigned) + sizeof(uint8_t) + sizeof(transaction.address))
+
+// Exported transaction size
+#define EXPORTED_TRANSACTION_SIZE (sizeof(uint64_t) + TRANSACTION_CONTEXT_SIZE + POLY1305_TAG_SIZE)
+
+// Transaction export key size
+#define TRANSACTION_EXPORT_KEY_SIZE 32
+
+// Maximum number of exported transactions
+#define MAXIMUM_NUMBER_OF_EXPORTED_TRANSACTIONS (sizeof(uint64_t) * BITS_IN_A_BYTE)
+
+
 // Structures
 
 // Transaction
@@ -41,6 +57,9 @@ struct Transaction {
 	// Secret nonce
 	volatile uint8_t secretNonce[NONCE_SIZE];
 
+	// Secret nonce sequence number
+	uint32_t secretNonceSequenceNumber;
+
 	// Address length
 	size_t addressLength;
 
@@ -56,15 +75,46 @@ struct Transaction {
 	// Secret nonce index
 	uint8_t secretNonceIndex;
 
+	// Public key cached
+	bool publicKeyCached;
+
+	// Public nonce cached
+	bool publicNonceCached;
+
+	// Public key
+	uint8_t publicKey[COMPRESSED_PUBLIC_KEY_SIZE];
+
+	// Public nonce
+	uint8_t publicNonce[COMPRESSED_PUBLIC_KEY_SIZE];
+
 	// Address
 	char address[TOR_ADDRESS_SIZE];
 };
 
+// Transaction exports
+struct TransactionExports {
+
+	// Key
+	volatile uint8_t key[TRANSACTION_EXPORT_KEY_SIZE];
+
+	// Key created
+	bool keyCreated;
+
+	// Counter
+	uint64_t counter;
+
+	// Pending counters
+	uint64_t pendingCounters;
+};
+
 
 // Global variables
 
 // Transaction
-extern struct Transaction transaction;
+extern SESSION_LOCAL struct Transaction transaction;
+
+// Transaction exports
+extern SESSION_LOCAL struct TransactionExports transactionExports;
 
 
 // Function prototypes
@@ -81,5 +131,17 @@ void restoreTransactionSecretNonce(void);
 // Clear transaction secret nonce
 void clearTransactionSecretNonce(void);
 
+// Get transaction public key
+const uint8_t *getTransactionPublicKey(void);
+
+// Get transaction public nonce
+const uint8_t *getTransactionPublicNonce(void);
+
+// Export transaction
+void exportTransaction(uint8_t *exportedTransaction);
+
+// Import transaction
+void importTransaction(const uint8_t *exportedTransaction);
+
 
 #endif
@@ -1,5 +1,6 @@
 // Install dependencies: npm i @ledgerhq/hw-transport-node-speculos @ledgerhq/hw-transport-node-hid
 // Run: node main.js mimblewimble_coin speculos nanos
+// Run sharded: node sharded.js mimblewimble_coin nanos:4,stax:2
 
 // Use strict
 "use strict";
@@ -33,6 +34,9 @@ const SlateKernel = require("./slate_kernel.js");
 // Request class
 const REQUEST_CLASS = 0xC7;
 
+// Chained request class
+const CHAINED_REQUEST_CLASS = 0xD7;
+
 // Request get root public key instruction
 const REQUEST_GET_ROOT_PUBLIC_KEY_INSTRUCTION = 0;
 
@@ -102,9 +106,48 @@ const REQUEST_GET_MQS_CHALLENGE_SIGNATURE_INSTRUCTION = REQUEST_FINISH_TRANSACTI
 // Request get login challenge signature instruction
 const REQUEST_GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION = REQUEST_GET_MQS_CHALLENGE_SIGNATURE_INSTRUCTION + 1;
 
+// Request start getting commitments instruction
+const REQUEST_START_GETTING_COMMITMENTS_INSTRUCTION = REQUEST_GET_LOGIN_CHALLENGE_SIGNATURE_INSTRUCTION + 1;
+
+// Request continue getting commitments instruction
+const REQUEST_CONTINUE_GETTING_COMMITMENTS_INSTRUCTION = REQUEST_START_GETTING_COMMITMENTS_INSTRUCTION + 1;
+
+// Request export transaction instruction
+const REQUEST_EXPORT_TRANSACTION_INSTRUCTION = REQUEST_CONTINUE_GETTING_COMMITMENTS_INSTRUCTION + 1;
+
+// Request import transaction instruction
+const REQUEST_IMPORT_TRANSACTION_INSTRUCTION = REQUEST_EXPORT_TRANSACTION_INSTRUCTION + 1;
+
+// Request batch instruction
+const REQUEST_BATCH_INSTRUCTION = REQUEST_IMPORT_TRANSACTION_INSTRUCTION + 1;
+
+// Request get response instruction
+const REQUEST_GET_RESPONSE_INSTRUCTION = 0xC0;
+
+// Success response code
+const SUCCESS_RESPONSE_CODE = 0x9000;
+
+// More response data response code
+const MORE_RESPONSE_DATA_RESPONSE_CODE = 0x9100;
+
+// Invalid parameters response code
+const INVALID_PARAMETERS_RESPONSE_CODE = 0xD100;
+
 // No parameter
 const NO_PARAMETER = 0;
 
+// Last chunk parameter
+const LAST_CHUNK_PARAMETER = 1;
+
+// Padded chunks session cipher version
+const PADDED_CHUNKS_SESSION_CIPHER_VERSION = 0;
+
+// Streaming session cipher version
+const STREAMING_SESSION_CIPHER_VERSION = 1;
+
+// Other slate session handle
+const OTHER_SLATE_SESSION_HANDLE = 1;
+
 // Mnemonic
 const MNEMONIC = "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about";
 
@@ -154,6 +197,12 @@ const SPECULOS_AUTOMATION_PORT = 5000;
 const DEFAULT_CURRENCY = "mimblewimble_coin";
 
 
+// Global variables
+
+// Automation port
+let automationPort = SPECULOS_AUTOMATION_PORT;
+
+
 // Main fucntion
 (async function() {
 
@@ -198,6 +247,12 @@ const DEFAULT_CURRENCY = "mimblewimble_coin";
 	// Get target from the command line arguments if provided
 	const target = (useSpeculos === true && process["argv"]["length"] >= 5) ? process["argv"][4] : null;
 	
+	// Get APDU port from the command line arguments if provided
+	const apduPort = (useSpeculos === true && process["argv"]["length"] >= 6) ? parseInt(process["argv"][5], 10) : SPECULOS_APDU_PORT;
+	
+	// Set automation port from the command line arguments if provided
+	automationPort = (useSpeculos === true && process["argv"]["length"] >= 7) ? parseInt(process["argv"][6], 10) : SPECULOS_AUTOMATION_PORT;
+	
 	// Log message
 	console.log("Using currency: " + currency);
 
@@ -205,7 +260,7 @@ const DEFAULT_CURRENCY = "mimblewimble_coin";
 	await initializeDependencies();
 	
 	// Perform tests
-	await performTests(useSpeculos, target);
+	await performTests(useSpeculos, target, apduPort);
 })();
 
 
@@ -228,7 +283,7 @@ async function initializeDependencies() {
 }
 
 // Perform tests
-async function performTests(useSpeculos, target) {
+async function performTests(useSpeculos, target, apduPort) {
 	
 	// Try
 	try {
@@ -240,7 +295,7 @@ async function performTests(useSpeculos, target) {
 			var hardwareWallet = await SpeculosTransport.open({
 			
 				// APDU port
-				"apduPort": SPECULOS_APDU_PORT
+				"apduPort": apduPort
 			});
 			
 			// Check if target exists
@@ -277,95 +332,29 @@ async function performTests(useSpeculos, target) {
 		// Get the extended private key from the seed
 		const extendedPrivateKey = await seed.getExtendedPrivateKey(SEED_KEY, true);
 		
-		// Run get application information test
-		await getApplicationInformationTest(hardwareWallet);
-		
-		// Run get root public key test
-		await getRootPublicKeyTest(hardwareWallet, extendedPrivateKey);
-		
-		// Run get address test
-		await getAddressTest(hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
-		await getAddressTest(hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
-		
-		// Run get seed cookie test
-		await getSeedCookieTest(hardwareWallet, extendedPrivateKey);
-		
-		// Run get commitment test
-		await getCommitmentTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR);
-		
-		// Run get bulletproof test
-		await getBulletproofTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SENDING_TRANSACTION_MESSAGE_TYPE);
-		await getBulletproofTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, RECEIVING_TRANSACTION_MESSAGE_TYPE);
-		await getBulletproofTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, CREATING_COINBASE_MESSAGE_TYPE);
-		
-		// Run verify root public key test
-		await verifyRootPublicKeyTest(hardwareWallet, extendedPrivateKey);
-		
-		// Run verify address test
-		await verifyAddressTest(hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
-		await verifyAddressTest(hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
-		
-		// Run encrypt slate test
-		await encryptSlateTest(hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
-		await encryptSlateTest(hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
-		
-		// Run decrypt slate test
-		await decryptSlateTest(hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
-		await decryptSlateTest(hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
-		
-		// Run receive transaction test
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.COINBASE_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.COINBASE_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await receiveTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		
-		// Run send transaction test
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
-		await sendTransactionTest(hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
-		
-		// Run get MQS timestamp signature test
-		await getMqsTimestampSignatureTest(hardwareWallet, extendedPrivateKey);
-		
-		// Run get MQS default challenge signature test
-		await getMqsDefaultChallengeSignatureTest(hardwareWallet, extendedPrivateKey);
-		
-		// Run get login signature test
-		await getLoginSignatureTest(hardwareWallet, extendedPrivateKey);
+		// Get tests
+		const tests = getTests(hardwareWallet, extendedPrivateKey);
 		
-		// Log message
-		console.log("Passed running all functional tests");
+		// Check if running as a shard of the sharded runner
+		if(typeof process["send"] === "function") {
+		
+			// Run shard
+			await runShard(tests);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Go through all tests
+			for(const test of tests) {
+			
+				// Run test
+				await test["run"]();
+			}
+			
+			// Log message
+			console.log("Passed running all functional tests");
+		}
 		
 		// Exit with success
 		process.exit(0);
@@ -385,6 +374,207 @@ async function performTests(useSpeculos, target) {
 	}
 }
 
+// Get tests
+function getTests(hardwareWallet, extendedPrivateKey) {
+
+	// Initialize tests
+	const tests = [];
+	
+	// Initialize number of tests for each test function
+	const numberOfTests = {};
+	
+	// Add test
+	const addTest = function(testFunction, ...parameters) {
+	
+		// Update number of tests for the test function
+		numberOfTests[testFunction["name"]] = (testFunction["name"] in numberOfTests === true) ? numberOfTests[testFunction["name"]] + 1 : 1;
+	
+		// Append test to the list
+		tests.push({
+		
+			// Name
+			"name": testFunction["name"] + " " + numberOfTests[testFunction["name"]].toFixed(),
+			
+			// Run
+			"run": function() {
+			
+				// Return running the test function with its parameters
+				return testFunction(...parameters);
+			}
+		});
+	};
+	
+	// Add get application information test
+	addTest(getApplicationInformationTest, hardwareWallet);
+	
+	// Add get root public key test
+	addTest(getRootPublicKeyTest, hardwareWallet, extendedPrivateKey);
+	
+	// Add get address test
+	addTest(getAddressTest, hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
+	addTest(getAddressTest, hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
+	
+	// Add get seed cookie test
+	addTest(getSeedCookieTest, hardwareWallet, extendedPrivateKey);
+	
+	// Add get commitment test
+	addTest(getCommitmentTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR);
+	
+	// Add get commitments test
+	addTest(getCommitmentsTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, false);
+	addTest(getCommitmentsTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, true);
+	
+	// Add batch test
+	addTest(batchTest, hardwareWallet);
+	
+	// Add get bulletproof test
+	addTest(getBulletproofTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SENDING_TRANSACTION_MESSAGE_TYPE);
+	addTest(getBulletproofTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, RECEIVING_TRANSACTION_MESSAGE_TYPE);
+	addTest(getBulletproofTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, CREATING_COINBASE_MESSAGE_TYPE);
+	
+	// Add verify root public key test
+	addTest(verifyRootPublicKeyTest, hardwareWallet, extendedPrivateKey);
+	
+	// Add verify address test
+	addTest(verifyAddressTest, hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
+	addTest(verifyAddressTest, hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
+	
+	// Add encrypt slate test
+	addTest(encryptSlateTest, hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE);
+	addTest(encryptSlateTest, hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE);
+	
+	// Add decrypt slate test
+	addTest(decryptSlateTest, hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE, PADDED_CHUNKS_SESSION_CIPHER_VERSION);
+	addTest(decryptSlateTest, hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE, PADDED_CHUNKS_SESSION_CIPHER_VERSION);
+	addTest(decryptSlateTest, hardwareWallet, extendedPrivateKey, MQS_ADDRESS_TYPE, STREAMING_SESSION_CIPHER_VERSION);
+	addTest(decryptSlateTest, hardwareWallet, extendedPrivateKey, TOR_ADDRESS_TYPE, STREAMING_SESSION_CIPHER_VERSION);
+	
+	// Add receive transaction test
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.COINBASE_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.COINBASE_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(receiveTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	
+	// Add send transaction test
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.PLAIN_FEATURES, Slate.NO_LOCK_HEIGHT, SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.HEIGHT_LOCKED_FEATURES, new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)), SlateKernel.NO_RELATIVE_HEIGHT, TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), MQS_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, NO_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, MQS_PAYMENT_PROOF_TYPE);
+	addTest(sendTransactionTest, hardwareWallet, extendedPrivateKey, Crypto.SWITCH_TYPE_REGULAR, SlateKernel.NO_RECENT_DUPLICATE_FEATURES, Slate.NO_LOCK_HEIGHT, new BigNumber(Math.floor(Math.random() * (SlateKernel.MAXIMUM_RECENT_HEIGHT - SlateKernel.MINIMUM_RECENT_HEIGHT + 1)) + SlateKernel.MINIMUM_RECENT_HEIGHT), TOR_ADDRESS_TYPE, TOR_PAYMENT_PROOF_TYPE);
+	
+	// Add get MQS timestamp signature test
+	addTest(getMqsTimestampSignatureTest, hardwareWallet, extendedPrivateKey);
+	
+	// Add get MQS default challenge signature test
+	addTest(getMqsDefaultChallengeSignatureTest, hardwareWallet, extendedPrivateKey);
+	
+	// Add get login signature test
+	addTest(getLoginSignatureTest, hardwareWallet, extendedPrivateKey);
+	
+	// Return tests
+	return tests;
+}
+
+// Run shard
+function runShard(tests) {
+
+	// Return promise
+	return new Promise(function(resolve, reject) {
+	
+		// Process message event
+		process.on("message", async function(message) {
+		
+			// Check if message is to run a test
+			if(message["type"] === "run") {
+			
+				// Get start time
+				const startTime = process.hrtime.bigint();
+				
+				// Try
+				let error = null;
+				try {
+				
+					// Run test
+					await tests[message["index"]]["run"]();
+				}
+				
+				// Catch errors
+				catch(caughtError) {
+				
+					// Set error
+					error = String(caughtError);
+				}
+				
+				// Send result to the sharded runner
+				process.send({
+				
+					// Type
+					"type": "result",
+					
+					// Index
+					"index": message["index"],
+					
+					// Error
+					"error": error,
+					
+					// Seconds
+					"seconds": Number(process.hrtime.bigint() - startTime) / 1e9
+				});
+			}
+			
+			// Otherwise check if message is to exit
+			else if(message["type"] === "exit") {
+			
+				// Resolve
+				resolve();
+			}
+		});
+		
+		// Send tests to the sharded runner
+		process.send({
+		
+			// Type
+			"type": "ready",
+			
+			// Tests
+			"tests": tests.map(function(test) {
+			
+				// Return test's name
+				return test["name"];
+			})
+		});
+	});
+}
+
 // Set automation
 function setAutomation(automation) {
 
@@ -401,7 +591,7 @@ function setAutomation(automation) {
 			"hostname": "localhost",
 			
 			// Port
-			"port": SPECULOS_AUTOMATION_PORT,
+			"port": automationPort,
 			
 			// Path
 			"path": "/automation",
@@ -854,6 +1044,206 @@ async function getCommitmentTest(hardwareWallet, extendedPrivateKey, switchType)
 	console.log("Passed getting commitment test");
 }
 
+// Get commitments test
+async function getCommitmentsTest(hardwareWallet, extendedPrivateKey, switchType, useChainedRequest) {
+
+	// Log message
+	console.log("Running get commitments test" + ((useChainedRequest === true) ? " with a chained request" : ""));
+	
+	// Number of commitments
+	const NUMBER_OF_COMMITMENTS = (useChainedRequest === true) ? 11 : 7;
+	
+	// Chained request chunk size
+	const CHAINED_REQUEST_CHUNK_SIZE = 64;
+	
+	// Maximum index delta
+	const MAXIMUM_INDEX_DELTA = 1000;
+	
+	// Base identifier
+	const BASE_IDENTIFIER = new Identifier(Common.toHexString(Common.mergeArrays([new Uint8Array([1 + Math.round(Math.random() * (Identifier.MAX_DEPTH - 1))]), crypto.getRandomValues(new Uint8Array(Identifier.MAX_DEPTH * Uint32Array["BYTES_PER_ELEMENT"]))])));
+	
+	// Log base identifier
+	console.log("Using base identifier: " + Common.toHexString(BASE_IDENTIFIER.getValue()));
+	
+	// Start getting commitments on the hardware wallet
+	await hardwareWallet.send(REQUEST_CLASS, REQUEST_START_GETTING_COMMITMENTS_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.concat([
+				
+		// Account
+		Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)),
+		
+		// Base identifier
+		Buffer.from(BASE_IDENTIFIER.getValue()),
+		
+		// Switch type
+		Buffer.from(new Uint8Array([switchType]))
+	]));
+	
+	// Go through all commitments
+	const requests = [];
+	const expectedCommitments = [];
+	for(let i = 0; i < NUMBER_OF_COMMITMENTS; ++i) {
+	
+		// Get index delta that doesn't overflow the base identifier's last path
+		const indexDelta = Math.min(Math.round(Math.random() * MAXIMUM_INDEX_DELTA), Common.UINT32_MAX_VALUE - BASE_IDENTIFIER.getLastPath());
+		
+		// Get amount
+		const amount = new BigNumber(Math.round(Math.random() * Number.MAX_SAFE_INTEGER)).plus(1);
+		
+		// Get identifier from the base identifier and index delta
+		const paths = new Uint32Array(BASE_IDENTIFIER.getPaths());
+		paths[BASE_IDENTIFIER.getDepth() - 1] += indexDelta;
+		const identifier = new Identifier();
+		identifier.setValue(BASE_IDENTIFIER.getDepth(), paths);
+		
+		// Append index delta and amount to requests
+		requests.push(Buffer.from(new BigNumber(indexDelta).toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)));
+		requests.push(Buffer.from(amount.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT64)));
+		
+		// Append the expected commitment from the extended private key, amount, identifier, and switch type to expected commitments
+		expectedCommitments.push(await Crypto.commit(extendedPrivateKey, amount, identifier, switchType));
+	}
+	
+	// Check if using a chained request
+	let response;
+	if(useChainedRequest === true) {
+	
+		// Go through all chunks of the requests except the last chunk
+		const data = Buffer.concat(requests);
+		let offset = 0;
+		for(; offset + CHAINED_REQUEST_CHUNK_SIZE < data["length"]; offset += CHAINED_REQUEST_CHUNK_SIZE) {
+		
+			// Send chunk to the hardware wallet
+			await hardwareWallet.send(CHAINED_REQUEST_CLASS, REQUEST_CONTINUE_GETTING_COMMITMENTS_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, data.subarray(offset, offset + CHAINED_REQUEST_CHUNK_SIZE));
+		}
+		
+		// Get commitments' first segment from the hardware wallet by sending the last chunk
+		let segment = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_GETTING_COMMITMENTS_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, data.subarray(offset), [SUCCESS_RESPONSE_CODE, MORE_RESPONSE_DATA_RESPONSE_CODE]);
+		
+		// Go through all segments
+		const segments = [];
+		while(true) {
+		
+			// Append segment without its response code to segments
+			segments.push(segment.subarray(0, segment["length"] - RESPONSE_DELIMITER_LENGTH));
+			
+			// Check if no more segments exist
+			if(segment.readUInt16BE(segment["length"] - RESPONSE_DELIMITER_LENGTH) !== MORE_RESPONSE_DATA_RESPONSE_CODE) {
+			
+				// Break
+				break;
+			}
+			
+			// Get next segment from the hardware wallet
+			segment = await hardwareWallet.send(REQUEST_CLASS, REQUEST_GET_RESPONSE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.alloc(0), [SUCCESS_RESPONSE_CODE, MORE_RESPONSE_DATA_RESPONSE_CODE]);
+		}
+		
+		// Set response to the segments
+		response = Buffer.concat(segments);
+	}
+	
+	// Otherwise
+	else {
+	
+		// Get commitments from the hardware wallet
+		response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_GETTING_COMMITMENTS_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.concat(requests));
+		
+		// Remove response code from response
+		response = response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH);
+	}
+	
+	// Log commitments
+	console.log("Commitments: " + Common.toHexString(response));
+	
+	// Check if commitments are invalid
+	if(Common.arraysAreEqual(response, Common.mergeArrays(expectedCommitments)) === false) {
+	
+		// Log message
+		console.log("Invalid commitments");
+		
+		// Throw error
+		throw "Failed running get commitments test";
+	}
+	
+	// Log message
+	console.log("Passed getting commitments test");
+}
+
+// Batch test
+async function batchTest(hardwareWallet) {
+
+	// Log message
+	console.log("Running batch test");
+	
+	// Requests
+	const REQUESTS = [
+	
+		// Get seed cookie request
+		Buffer.concat([Buffer.from([REQUEST_CLASS, REQUEST_GET_SEED_COOKIE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Common.BYTES_IN_A_UINT32]), Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32))]),
+		
+		// Get address request
+		Buffer.concat([Buffer.from([REQUEST_CLASS, REQUEST_GET_ADDRESS_INSTRUCTION, MQS_ADDRESS_TYPE, NO_PARAMETER, Common.BYTES_IN_A_UINT32 + Common.BYTES_IN_A_UINT32]), Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)), Buffer.from(INDEX.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32))]),
+		
+		// Verify root public key request that can't be batched
+		Buffer.concat([Buffer.from([REQUEST_CLASS, REQUEST_VERIFY_ROOT_PUBLIC_KEY_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Common.BYTES_IN_A_UINT32]), Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32))])
+	];
+	
+	// Get expected responses by sending the requests that can be batched separately
+	const expectedResponses = [];
+	for(let i = 0; i < REQUESTS["length"] - 1; ++i) {
+	
+		// Send request to the hardware wallet
+		const response = await hardwareWallet.send(REQUESTS[i][0], REQUESTS[i][1], REQUESTS[i][2], REQUESTS[i][3], REQUESTS[i].subarray(5));
+		
+		// Append response without its response code to expected responses
+		expectedResponses.push(response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH));
+	}
+	
+	// Perform batch on the hardware wallet
+	let response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_BATCH_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.concat(REQUESTS));
+	
+	// Remove response code from response
+	response = response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH);
+	
+	// Go through all records in the response
+	const responses = [];
+	for(let offset = 0; offset < response["length"];) {
+	
+		// Check if record's response code isn't success
+		if(response.readUInt16BE(offset) !== SUCCESS_RESPONSE_CODE) {
+		
+			// Log message
+			console.log("Invalid batch response code");
+			
+			// Throw error
+			throw "Failed running batch test";
+		}
+		
+		// Append record's response to responses
+		const length = response[offset + Common.BYTES_IN_A_UINT16];
+		responses.push(response.subarray(offset + Common.BYTES_IN_A_UINT16 + 1, offset + Common.BYTES_IN_A_UINT16 + 1 + length));
+		
+		offset += Common.BYTES_IN_A_UINT16 + 1 + length;
+	}
+	
+	// Check if batch didn't stop before the request that can't be batched or its responses are invalid
+	if(responses["length"] !== expectedResponses["length"] || responses.every(function(value, index) {
+	
+		// Return if response is equal to the expected response
+		return Common.arraysAreEqual(value, expectedResponses[index]) === true;
+		
+	}) === false) {
+	
+		// Log message
+		console.log("Invalid batch responses");
+		
+		// Throw error
+		throw "Failed running batch test";
+	}
+	
+	// Log message
+	console.log("Passed batch test");
+}
+
 // Get bulletproof test
 async function getBulletproofTest(hardwareWallet, extendedPrivateKey, switchType, messageType) {
 
@@ -1235,7 +1625,7 @@ async function encryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 		const DATA = crypto.getRandomValues(new Uint8Array(Math.round(Math.random() * Common.BYTE_MAX_VALUE + 1)));
 		
 		// Maximum chunk size
-		const MAXIMUM_CHUNK_SIZE = 64;
+		const MAXIMUM_CHUNK_SIZE = 192;
 		
 		// Domain
 		const DOMAIN = "example.com";
@@ -1345,7 +1735,7 @@ async function encryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 		for(let i = 0; i < Math.ceil(DATA["length"] / MAXIMUM_CHUNK_SIZE); ++i) {
 		
 			// Continue encrypting slate on the hardware wallet
-			response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_ENCRYPTING_SLATE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.from(DATA.subarray(i * MAXIMUM_CHUNK_SIZE, i * MAXIMUM_CHUNK_SIZE + MAXIMUM_CHUNK_SIZE)));
+			response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_ENCRYPTING_SLATE_INSTRUCTION, (i === Math.ceil(DATA["length"] / MAXIMUM_CHUNK_SIZE) - 1) ? LAST_CHUNK_PARAMETER : NO_PARAMETER, NO_PARAMETER, Buffer.from(DATA.subarray(i * MAXIMUM_CHUNK_SIZE, i * MAXIMUM_CHUNK_SIZE + MAXIMUM_CHUNK_SIZE)));
 			
 			// Remove response code from response
 			response = response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH);
@@ -1477,7 +1867,7 @@ async function encryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 }
 
 // Decrypt slate test
-async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType) {
+async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType, sessionCipherVersion) {
 
 	// Check if not using Speculos
 	if(hardwareWallet instanceof SpeculosTransport === false) {
@@ -1489,7 +1879,7 @@ async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 		const DATA = crypto.getRandomValues(new Uint8Array(Math.round(Math.random() * Common.BYTE_MAX_VALUE + 1)));
 		
 		// Maximum chunk size
-		const MAXIMUM_CHUNK_SIZE = 64;
+		const MAXIMUM_CHUNK_SIZE = 192;
 		
 		// AES IV size
 		const AES_IV_SIZE = 16;
@@ -1602,7 +1992,7 @@ async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 		encryptedMessage = encryptedMessage.subarray(0, encryptedMessage["length"] - Slatepack.TAG_LENGTH);
 		
 		// Start decrypting slate on the hardware wallet
-		let response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_START_DECRYPTING_SLATE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.concat([
+		let response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_START_DECRYPTING_SLATE_INSTRUCTION, sessionCipherVersion, NO_PARAMETER, Buffer.concat([
 					
 			// Account
 			Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)),
@@ -1620,12 +2010,25 @@ async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 			Buffer.from(salt)
 		]));
 		
+		// Start encrypting a slate with another slate session handle on the hardware wallet which shouldn't affect decrypting this slate
+		await hardwareWallet.send(REQUEST_CLASS, REQUEST_START_ENCRYPTING_SLATE_INSTRUCTION, NO_PARAMETER, OTHER_SLATE_SESSION_HANDLE, Buffer.concat([
+					
+			// Account
+			Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)),
+			
+			// Index
+			Buffer.from(INDEX.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)),
+			
+			// Address
+			Buffer.from(address)
+		]));
+		
 		// Go through all chunks of the encrypted message
 		const decryptedDataChunks = [];
 		for(let i = 0; i < Math.ceil(encryptedMessage["length"] / MAXIMUM_CHUNK_SIZE); ++i) {
 		
 			// Continue decrypting slate on the hardware wallet
-			response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_DECRYPTING_SLATE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.from(encryptedMessage.subarray(i * MAXIMUM_CHUNK_SIZE, i * MAXIMUM_CHUNK_SIZE + MAXIMUM_CHUNK_SIZE)));
+			response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_DECRYPTING_SLATE_INSTRUCTION, (i === Math.ceil(encryptedMessage["length"] / MAXIMUM_CHUNK_SIZE) - 1) ? LAST_CHUNK_PARAMETER : NO_PARAMETER, NO_PARAMETER, Buffer.from(encryptedMessage.subarray(i * MAXIMUM_CHUNK_SIZE, i * MAXIMUM_CHUNK_SIZE + MAXIMUM_CHUNK_SIZE)));
 			
 			// Remove response code from response
 			response = response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH);
@@ -1646,15 +2049,26 @@ async function decryptSlateTest(hardwareWallet, extendedPrivateKey, addressType)
 		// Create AES key from response
 		const aesKey = await crypto["subtle"].importKey("raw", response, {"name": "AES-CBC"}, false, ["decrypt"]);
 		
-		// Go through all decrypted data chunks
+		// Check if session cipher version is streaming
 		let decryptedData = new Uint8Array([]);
-		for(let i = 0; i < decryptedDataChunks["length"]; ++i) {
+		if(sessionCipherVersion === STREAMING_SESSION_CIPHER_VERSION) {
+		
+			// Decrypt all the data chunks as a single stream with the AES key
+			decryptedData = new Uint8Array(await crypto["subtle"].decrypt({"name": "AES-CBC", "iv": new Uint8Array(AES_IV_SIZE)}, aesKey, Common.mergeArrays(decryptedDataChunks)));
+		}
 		
-			// Decrypt the data chunk with the AES key
-			const data = new Uint8Array(await crypto["subtle"].decrypt({"name": "AES-CBC", "iv": new Uint8Array(AES_IV_SIZE)}, aesKey, decryptedDataChunks[i]));
+		// Otherwise
+		else {
+		
+			// Go through all decrypted data chunks
+			for(let i = 0; i < decryptedDataChunks["length"]; ++i) {
 			
-			// Append decrypted data chunk to list
-			decryptedData = Common.mergeArrays([decryptedData, data]);
+				// Decrypt the data chunk with the AES key
+				const data = new Uint8Array(await crypto["subtle"].decrypt({"name": "AES-CBC", "iv": new Uint8Array(AES_IV_SIZE)}, aesKey, decryptedDataChunks[i]));
+				
+				// Append decrypted data chunk to list
+				decryptedData = Common.mergeArrays([decryptedData, data]);
+			}
 		}
 		
 		// Log decrypted slate
@@ -1968,6 +2382,31 @@ async function receiveTransactionTest(hardwareWallet, extendedPrivateKey, switch
 	// Log transaction public nonce
 	console.log("Transaction public nonce: " + Common.toHexString(publicNonce));
 	
+	// Export the transaction from the hardware wallet
+	response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_EXPORT_TRANSACTION_INSTRUCTION, NO_PARAMETER, NO_PARAMETER);
+	
+	// Get exported transaction from response
+	const exportedTransaction = response.subarray(0, response["length"] - RESPONSE_DELIMITER_LENGTH);
+	
+	// Perform an unrelated request on the hardware wallet
+	await hardwareWallet.send(REQUEST_CLASS, REQUEST_GET_SEED_COOKIE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.from(ACCOUNT.toBytes(BigNumber.LITTLE_ENDIAN, Common.BYTES_IN_A_UINT32)));
+	
+	// Import the transaction on the hardware wallet
+	await hardwareWallet.send(REQUEST_CLASS, REQUEST_IMPORT_TRANSACTION_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, exportedTransaction);
+	
+	// Get the transaction public nonce from the hardware wallet
+	response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_TRANSACTION_GET_PUBLIC_NONCE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER);
+	
+	// Check if imported transaction's public nonce is invalid
+	if(Common.arraysAreEqual(response.subarray(0, Crypto.SECP256K1_PUBLIC_KEY_LENGTH), publicNonce) === false) {
+	
+		// Log message
+		console.log("Invalid imported transaction public nonce");
+		
+		// Throw error
+		throw "Failed running receive transaction test";
+	}
+	
 	// Get the message signature from the hardware wallet
 	response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_CONTINUE_TRANSACTION_GET_MESSAGE_SIGNATURE_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.from((new TextEncoder()).encode(MESSAGE)));
 
@@ -2599,9 +3038,10 @@ async function sendTransactionTest(hardwareWallet, extendedPrivateKey, switchTyp
 	// Log offset
 	console.log("Using offset: " + Common.toHexString(offset));
 	
-	// Start transaction twice to test secret nonce index
+	// Start transaction three times to test secret nonce index and exporting a transaction that uses the same secret nonce
 	let secretNonceIndex = 0;
-	for(let i = 0; i < 2; ++i) {
+	let exportedTransaction;
+	for(let i = 0; i < 3; ++i) {
 	
 		// Start transaction on the hardware wallet
 		await hardwareWallet.send(REQUEST_CLASS, REQUEST_START_TRANSACTION_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, Buffer.concat([
@@ -2666,6 +3106,16 @@ async function sendTransactionTest(hardwareWallet, extendedPrivateKey, switchTyp
 			// Log secret nonce index
 			console.log("Secret nonce index: " + secretNonceIndex);
 		}
+		
+		// Check if the transaction was started a second time
+		if(i === 1) {
+		
+			// Export the transaction from the hardware wallet
+			const exportResponse = await hardwareWallet.send(REQUEST_CLASS, REQUEST_EXPORT_TRANSACTION_INSTRUCTION, NO_PARAMETER, NO_PARAMETER);
+			
+			// Get exported transaction from response
+			exportedTransaction = exportResponse.subarray(0, exportResponse["length"] - RESPONSE_DELIMITER_LENGTH);
+		}
 	}
 	
 	// Get the output's blinding factor
@@ -3070,6 +3520,19 @@ async function sendTransactionTest(hardwareWallet, extendedPrivateKey, switchTyp
 		throw "Failed running send transaction test";
 	}
 	
+	// Import the exported transaction that uses the same secret nonce on the hardware wallet
+	response = await hardwareWallet.send(REQUEST_CLASS, REQUEST_IMPORT_TRANSACTION_INSTRUCTION, NO_PARAMETER, NO_PARAMETER, exportedTransaction, [SUCCESS_RESPONSE_CODE, INVALID_PARAMETERS_RESPONSE_CODE]);
+	
+	// Check if importing the exported transaction didn't fail since its secret nonce was used
+	if(response.readUInt16BE(response["length"] - RESPONSE_DELIMITER_LENGTH) !== INVALID_PARAMETERS_RESPONSE_CODE) {
+	
+		// Log message
+		console.log("Imported transaction with a used secret nonce");
+		
+		// Throw error
+		throw "Failed running send transaction test";
+	}
+	
 	// Log message
 	console.log("Passed running send transaction test");
 }
@@ -0,0 +1,587 @@
+// Run: node sharded.js mimblewimble_coin nanos:4,stax:2 ["device command"] [results file]
+// The device command is ran once for each shard after replacing {target}, {apduPort}, and {automationPort} with the shard's values
+
+// Use strict
+"use strict";
+
+
+// Requires
+const childProcess = require("child_process");
+const fs = require("fs");
+const net = require("net");
+const path = require("path");
+
+
+// Constants
+
+// Default currency
+const DEFAULT_CURRENCY = "mimblewimble_coin";
+
+// Default shards
+const DEFAULT_SHARDS = "nanos:1";
+
+// Default device command
+const DEFAULT_DEVICE_COMMAND = "speculos.py bin/app.elf --model {target} --seed \"abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about\" --display headless --apdu-port {apduPort} --api-port {automationPort}";
+
+// First APDU port
+const FIRST_APDU_PORT = 9999;
+
+// First automation port
+const FIRST_AUTOMATION_PORT = 5000;
+
+// Device start timeout milliseconds
+const DEVICE_START_TIMEOUT_MILLISECONDS = 60 * 1000;
+
+// Device start poll interval milliseconds
+const DEVICE_START_POLL_INTERVAL_MILLISECONDS = 250;
+
+// Number of slowest tests
+const NUMBER_OF_SLOWEST_TESTS = 10;
+
+
+// Main function
+(async function() {
+	
+	// Get currency from the command line arguments if provided
+	const currency = (process["argv"]["length"] >= 3) ? process["argv"][2] : DEFAULT_CURRENCY;
+	
+	// Get shards from the command line arguments if provided
+	const shards = getShards((process["argv"]["length"] >= 4) ? process["argv"][3] : DEFAULT_SHARDS);
+	
+	// Check if shards are invalid
+	if(shards === null) {
+		
+		// Log message
+		console.log("Invalid shards. Shards are provided as a comma separated list of target:number of instances, for example nanos:4,stax:2");
+		
+		// Exit with error
+		process.exit(1);
+	}
+	
+	// Get device command from the command line arguments if provided
+	const deviceCommand = (process["argv"]["length"] >= 5) ? process["argv"][4] : DEFAULT_DEVICE_COMMAND;
+	
+	// Get results file from the command line arguments if provided
+	const resultsFile = (process["argv"]["length"] >= 6) ? process["argv"][5] : null;
+	
+	// Log message
+	console.log("Running functional tests for " + currency + " on " + shards["length"].toFixed() + " shard(s)");
+	
+	// Get targets from the shards
+	const targets = {};
+	for(const shard of shards) {
+		
+		// Check if target doesn't exist
+		if(shard["target"] in targets === false) {
+			
+			// Create target
+			targets[shard["target"]] = {
+				
+				// Tests
+				"tests": null,
+				
+				// Next test index
+				"nextTestIndex": 0,
+				
+				// Results
+				"results": []
+			};
+		}
+	}
+	
+	// Get start time
+	const startTime = process.hrtime.bigint();
+	
+	// Run all shards
+	await Promise.all(shards.map(function(shard) {
+		
+		// Return running shard
+		return runShard(shard, targets[shard["target"]], currency, deviceCommand);
+	}));
+	
+	// Get wall seconds
+	const wallSeconds = Number(process.hrtime.bigint() - startTime) / 1e9;
+	
+	// Log results and check if all tests passed
+	const passed = logResults(shards, targets, wallSeconds);
+	
+	// Check if results file is provided
+	if(resultsFile !== null) {
+		
+		// Write results to the results file
+		fs.writeFileSync(resultsFile, JSON.stringify({
+			
+			// Passed
+			"passed": passed,
+			
+			// Wall seconds
+			"wallSeconds": wallSeconds,
+			
+			// Shards
+			"shards": shards.map(function(shard) {
+				
+				// Return shard's summary
+				return {
+					
+					// Target
+					"target": shard["target"],
+					
+					// APDU port
+					"apduPort": shard["apduPort"],
+					
+					// Number of tests
+					"numberOfTests": shard["numberOfTests"],
+					
+					// Busy seconds
+					"busySeconds": shard["busySeconds"]
+				};
+			}),
+			
+			// Results
+			"results": Object.keys(targets).reduce(function(results, target) {
+				
+				// Return results with the target's results
+				return results.concat(targets[target]["results"]);
+			
+			}, [])
+		}, null, "\t"));
+	}
+	
+	// Exit with success or error
+	process.exit((passed === true) ? 0 : 1);
+})();
+
+
+// Supporting function implementation
+
+// Get shards
+function getShards(shardsString) {
+	
+	// Initialize shards
+	const shards = [];
+	
+	// Go through all targets in the shards string
+	for(const targetString of shardsString.split(",")) {
+		
+		// Get target and number of instances from the target string
+		const [target, numberOfInstancesString = "1"] = targetString.split(":");
+		const numberOfInstances = parseInt(numberOfInstancesString, 10);
+		
+		// Check if target or number of instances is invalid
+		if(target["length"] === 0 || /^[1-9]\d*$/u.test(numberOfInstancesString) === false) {
+			
+			// Return null
+			return null;
+		}
+		
+		// Go through all of the target's instances
+		for(let i = 0; i < numberOfInstances; ++i) {
+			
+			// Append shard to the list
+			shards.push({
+				
+				// Index
+				"index": shards["length"],
+				
+				// Target
+				"target": target,
+				
+				// APDU port
+				"apduPort": FIRST_APDU_PORT + shards["length"],
+				
+				// Automation port
+				"automationPort": FIRST_AUTOMATION_PORT + shards["length"],
+				
+				// Number of tests
+				"numberOfTests": 0,
+				
+				// Busy seconds
+				"busySeconds": 0
+			});
+		}
+	}
+	
+	// Return shards
+	return shards;
+}
+
+// Run shard
+async function runShard(shard, target, currency, deviceCommand) {
+	
+	// Start device
+	const device = childProcess.spawn(deviceCommand.replace(/\{target\}/gu, shard["target"]).replace(/\{apduPort\}/gu, shard["apduPort"].toFixed()).replace(/\{automationPort\}/gu, shard["automationPort"].toFixed()), {
+		
+		// Shell
+		"shell": true,
+		
+		// Detached
+		"detached": true,
+		
+		// Standard IO
+		"stdio": "ignore"
+	});
+	
+	// Try
+	try {
+		
+		// Wait for the device to start
+		await waitForDevice(device, shard["apduPort"]);
+		
+		// Run tests on the device
+		await runTests(shard, target, currency);
+	}
+	
+	// Catch errors
+	catch(error) {
+		
+		// Log message
+		console.log("Shard " + shard["index"].toFixed() + " (" + shard["target"] + ") failed: " + error);
+	}
+	
+	// Finally
+	finally {
+		
+		// Try
+		try {
+			
+			// Stop device and all of its child processes
+			process.kill(-device["pid"], "SIGTERM");
+		}
+		
+		// Catch errors
+		catch(error) {
+		
+		}
+	}
+}
+
+// Wait for device
+function waitForDevice(device, apduPort) {
+	
+	// Return promise
+	return new Promise(function(resolve, reject) {
+		
+		// Get timeout time
+		const timeoutTime = Date.now() + DEVICE_START_TIMEOUT_MILLISECONDS;
+		
+		// Device exit event
+		const exitHandler = function(code) {
+			
+			// Reject error
+			reject("Device exited with code " + String(code));
+		};
+		device.once("exit", exitHandler);
+		
+		// Try connecting
+		const tryConnecting = function() {
+			
+			// Connect to the device's APDU port
+			const socket = net.connect(apduPort, "localhost");
+			
+			// Socket connect event
+			socket.once("connect", function() {
+				
+				// Close socket
+				socket.destroy();
+				
+				// Remove device exit event
+				device.removeListener("exit", exitHandler);
+				
+				// Resolve
+				resolve();
+			});
+			
+			// Socket error event
+			socket.once("error", function() {
+				
+				// Close socket
+				socket.destroy();
+				
+				// Check if timeout occurred
+				if(Date.now() >= timeoutTime) {
+					
+					// Remove device exit event
+					device.removeListener("exit", exitHandler);
+					
+					// Reject error
+					reject("Device didn't start listening on port " + apduPort.toFixed());
+				}
+				
+				// Otherwise
+				else {
+					
+					// Try connecting again after a delay
+					setTimeout(tryConnecting, DEVICE_START_POLL_INTERVAL_MILLISECONDS);
+				}
+			});
+		};
+		
+		// Try connecting
+		tryConnecting();
+	});
+}
+
+// Run tests
+function runTests(shard, target, currency) {
+	
+	// Return promise
+	return new Promise(function(resolve, reject) {
+		
+		// Run functional tests as a shard
+		const worker = childProcess.fork(path.join(__dirname, "main.js"), [currency, "speculos", shard["target"], shard["apduPort"].toFixed(), shard["automationPort"].toFixed()], {
+			
+			// Silent
+			"silent": true
+		});
+		
+		// Initialize current test index and log
+		let currentTestIndex = null;
+		let log = "";
+		
+		// Worker output event
+		const outputHandler = function(data) {
+			
+			// Append data to the log
+			log += data.toString();
+		};
+		worker["stdout"].on("data", outputHandler);
+		worker["stderr"].on("data", outputHandler);
+		
+		// Run next test
+		const runNextTest = function() {
+			
+			// Check if target has no more tests
+			if(target["nextTestIndex"] === target["tests"]["length"]) {
+				
+				// Tell worker to exit
+				currentTestIndex = null;
+				worker.send({
+					
+					// Type
+					"type": "exit"
+				});
+			}
+			
+			// Otherwise
+			else {
+				
+				// Tell worker to run the target's next test
+				currentTestIndex = target["nextTestIndex"]++;
+				log = "";
+				worker.send({
+					
+					// Type
+					"type": "run",
+					
+					// Index
+					"index": currentTestIndex
+				});
+			}
+		};
+		
+		// Worker message event
+		worker.on("message", function(message) {
+			
+			// Check if message is that the worker is ready
+			if(message["type"] === "ready") {
+				
+				// Check if target's tests don't exist
+				if(target["tests"] === null) {
+					
+					// Set target's tests
+					target["tests"] = message["tests"];
+				}
+				
+				// Otherwise check if target's tests are different
+				else if(JSON.stringify(target["tests"]) !== JSON.stringify(message["tests"])) {
+					
+					// Kill worker
+					worker.kill();
+					
+					// Return
+					return;
+				}
+				
+				// Run next test
+				runNextTest();
+			}
+			
+			// Otherwise check if message is a test's result
+			else if(message["type"] === "result") {
+				
+				// Append result to the target's results
+				target["results"].push({
+					
+					// Target
+					"target": shard["target"],
+					
+					// Shard
+					"shard": shard["index"],
+					
+					// Name
+					"name": target["tests"][message["index"]],
+					
+					// Seconds
+					"seconds": message["seconds"],
+					
+					// Error
+					"error": message["error"],
+					
+					// Log
+					"log": (message["error"] !== null) ? log : null
+				});
+				
+				// Update shard's number of tests and busy seconds
+				++shard["numberOfTests"];
+				shard["busySeconds"] += message["seconds"];
+				
+				// Log message
+				console.log(((message["error"] === null) ? "Passed " : "Failed ") + shard["target"] + " " + target["tests"][message["index"]] + " on shard " + shard["index"].toFixed() + " in " + message["seconds"].toFixed(3) + " seconds");
+				
+				// Run next test
+				runNextTest();
+			}
+		});
+		
+		// Worker exit event
+		worker.on("exit", function(code) {
+			
+			// Check if worker exited while running a test
+			if(currentTestIndex !== null) {
+				
+				// Append failed result to the target's results
+				target["results"].push({
+					
+					// Target
+					"target": shard["target"],
+					
+					// Shard
+					"shard": shard["index"],
+					
+					// Name
+					"name": target["tests"][currentTestIndex],
+					
+					// Seconds
+					"seconds": 0,
+					
+					// Error
+					"error": "Shard exited with code " + String(code) + " while running the test",
+					
+					// Log
+					"log": log
+				});
+			}
+			
+			// Check if worker exited successfully
+			if(code === 0) {
+				
+				// Resolve
+				resolve();
+			}
+			
+			// Otherwise
+			else {
+				
+				// Reject error
+				reject("Functional tests exited with code " + String(code) + ((currentTestIndex === null && log["length"] !== 0) ? ":\n" + log : ""));
+			}
+		});
+	});
+}
+
+// Log results
+function logResults(shards, targets, wallSeconds) {
+	
+	// Initialize passed and total test seconds
+	let passed = true;
+	let totalTestSeconds = 0;
+	
+	// Go through all targets
+	for(const targetName of Object.keys(targets)) {
+		
+		// Get target
+		const target = targets[targetName];
+		
+		// Check if target's tests aren't known
+		if(target["tests"] === null) {
+			
+			// Log message
+			console.log("Target " + targetName + ": no shard ran any tests");
+			
+			// Set passed to false
+			passed = false;
+			
+			// Go to next target
+			continue;
+		}
+		
+		// Get target's failed results
+		const failedResults = target["results"].filter(function(result) {
+			
+			// Return if result failed
+			return result["error"] !== null;
+		});
+		
+		// Get target's number of tests that didn't run
+		const numberOfTestsNotRan = target["tests"]["length"] - target["results"]["length"];
+		
+		// Log message
+		console.log("Target " + targetName + ": " + target["tests"]["length"].toFixed() + " tests, " + (target["results"]["length"] - failedResults["length"]).toFixed() + " passed, " + failedResults["length"].toFixed() + " failed, " + numberOfTestsNotRan.toFixed() + " not ran");
+		
+		// Go through all failed results
+		for(const result of failedResults) {
+			
+			// Log message
+			console.log("Failed " + result["name"] + " on shard " + result["shard"].toFixed() + ": " + result["error"] + "\n" + result["log"]);
+		}
+		
+		// Check if any tests failed or didn't run
+		if(failedResults["length"] !== 0 || numberOfTestsNotRan !== 0) {
+			
+			// Set passed to false
+			passed = false;
+		}
+	}
+	
+	// Go through all shards
+	for(const shard of shards) {
+		
+		// Log message
+		console.log("Shard " + shard["index"].toFixed() + " (" + shard["target"] + " on APDU port " + shard["apduPort"].toFixed() + "): " + shard["numberOfTests"].toFixed() + " tests in " + shard["busySeconds"].toFixed(3) + " seconds");
+		
+		// Update total test seconds
+		totalTestSeconds += shard["busySeconds"];
+	}
+	
+	// Get slowest results
+	const slowestResults = Object.keys(targets).reduce(function(results, target) {
+		
+		// Return results with the target's results
+		return results.concat(targets[target]["results"]);
+	
+	}, []).sort(function(firstResult, secondResult) {
+		
+		// Return comparing results' seconds
+		return secondResult["seconds"] - firstResult["seconds"];
+	
+	}).slice(0, NUMBER_OF_SLOWEST_TESTS);
+	
+	// Log message
+	console.log("Slowest tests:");
+	
+	// Go through all slowest results
+	for(const result of slowestResults) {
+		
+		// Log message
+		console.log("  " + result["target"] + " " + result["name"] + ": " + result["seconds"].toFixed(3) + " seconds");
+	}
+	
+	// Log message
+	console.log("Ran " + totalTestSeconds.toFixed(3) + " seconds of tests in " + wallSeconds.toFixed(3) + " seconds (" + ((wallSeconds !== 0) ? totalTestSeconds / wallSeconds : 0).toFixed(2) + "x)");
+	
+	// Log message
+	console.log((passed === true) ? "Passed running all functional tests" : "Running functional tests failed");
+	
+	// Return passed
+	return passed;
+}
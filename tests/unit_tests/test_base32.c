@@ -24,6 +24,9 @@ static void testEncode(void **state);
 // Test decode
 static void testDecode(void **state);
 
+// Test decode invalid
+static void testDecodeInvalid(void **state);
+
 
 // Main function
 int main(void) {
@@ -35,7 +38,10 @@ int main(void) {
 		cmocka_unit_test(testEncode),
 		
 		// Test decode
-		cmocka_unit_test(testDecode)
+		cmocka_unit_test(testDecode),
+		
+		// Test decode invalid
+		cmocka_unit_test(testDecodeInvalid)
 	};
 	
 	// Return performing tests
@@ -62,7 +68,7 @@ void testEncode(void **state) {
 			
 			// Get output by encoding input
 			char output[outputLength + sizeof((char)'\0')];
-			base32Encode(output, INPUT, sizeof(INPUT));
+			assert_int_equal(base32Encode(output, INPUT, sizeof(INPUT)), outputLength);
 			output[outputLength] = '\0';
 			
 			// Assert output is correct
@@ -105,7 +111,7 @@ void testDecode(void **state) {
 			
 			// Get input by decoding output
 			uint8_t input[inputLength];
-			base32Decode(input, OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0'));
+			assert_int_equal(base32Decode(input, sizeof(input), OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0')), inputLength);
 			
 			// Assert input is correct
 			assert_memory_equal(input, INPUT, sizeof(INPUT));
@@ -129,3 +135,43 @@ void testDecode(void **state) {
 	// End try
 	END_TRY;
 }
+
+// Test decode invalid
+void testDecodeInvalid(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Assert decoding output with an invalid character fails
+			uint8_t input[sizeof(INPUT)];
+			assert_int_equal(base32Decode(input, sizeof(input), "aakhkhtw5amzdfwukskbyrorworsh4kdhpl1====", sizeof(OUTPUT) - sizeof((char)'\0')), INVALID_BASE32_SIZE);
+			
+			// Assert decoding output with invalid padding fails
+			assert_int_equal(base32Decode(input, sizeof(input), "aakhkhtw5amzdfwukskbyrorworsh4kdhpla===", sizeof(OUTPUT) - sizeof((char)'\0') - 1), INVALID_BASE32_SIZE);
+			assert_int_equal(base32Decode(input, sizeof(input), "aakhkhtw5amzdfwukskbyrorworsh4kdhp=a====", sizeof(OUTPUT) - sizeof((char)'\0')), INVALID_BASE32_SIZE);
+			
+			// Assert decoding output into a result that's too small fails
+			assert_int_equal(base32Decode(input, sizeof(input) - 1, OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0')), INVALID_BASE32_SIZE);
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
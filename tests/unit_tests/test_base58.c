@@ -36,6 +36,9 @@ static void testEncodeWithChecksum(void **state);
 // Test decode with checksum
 static void testDecodeWithChecksum(void **state);
 
+// Test decode invalid
+static void testDecodeInvalid(void **state);
+
 
 // Main function
 int main(void) {
@@ -53,7 +56,10 @@ int main(void) {
 		cmocka_unit_test(testEncodeWithChecksum),
 		
 		// Test decode with checksum
-		cmocka_unit_test(testDecodeWithChecksum)
+		cmocka_unit_test(testDecodeWithChecksum),
+		
+		// Test decode invalid
+		cmocka_unit_test(testDecodeInvalid)
 	};
 	
 	// Return performing tests
@@ -80,7 +86,7 @@ void testEncode(void **state) {
 			
 			// Get output by encoding input
 			char output[outputLength + sizeof((char)'\0')];
-			base58Encode(output, INPUT, sizeof(INPUT));
+			assert_int_equal(base58Encode(output, INPUT, sizeof(INPUT)), outputLength);
 			output[outputLength] = '\0';
 			
 			// Assert output is correct
@@ -123,7 +129,7 @@ void testDecode(void **state) {
 			
 			// Get input by decoding output
 			uint8_t input[inputLength];
-			base58Decode(input, OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0'));
+			assert_int_equal(base58Decode(input, sizeof(input), OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0')), inputLength);
 			
 			// Assert input is correct
 			assert_memory_equal(input, INPUT, sizeof(INPUT));
@@ -167,7 +173,7 @@ void testEncodeWithChecksum(void **state) {
 			
 			// Get output by encoding input
 			char output[outputLength + sizeof((char)'\0')];
-			base58EncodeWithChecksum(output, temp, sizeof(temp));
+			assert_int_equal(base58EncodeWithChecksum(output, temp, sizeof(temp)), outputLength);
 			output[outputLength] = '\0';
 			
 			// Assert output is correct
@@ -210,7 +216,7 @@ void testDecodeWithChecksum(void **state) {
 			
 			// Get input by decoding output
 			uint8_t input[inputLength];
-			base58DecodeWithChecksum(input, OUTPUT_WITH_CHECKSUM, sizeof(OUTPUT_WITH_CHECKSUM) - sizeof((char)'\0'));
+			assert_int_equal(base58DecodeWithChecksum(input, sizeof(input), OUTPUT_WITH_CHECKSUM, sizeof(OUTPUT_WITH_CHECKSUM) - sizeof((char)'\0')), inputLength);
 			
 			// Assert input is correct
 			assert_memory_equal(input, INPUT, sizeof(INPUT));
@@ -237,3 +243,42 @@ void testDecodeWithChecksum(void **state) {
 	// End try
 	END_TRY;
 }
+
+// Test decode invalid
+void testDecodeInvalid(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Assert decoding output with an invalid character fails
+			uint8_t input[sizeof(INPUT) + BASE58_CHECKSUM_SIZE];
+			assert_int_equal(base58Decode(input, sizeof(input), "12FxnjQTEntrwaJWMQz295hzRDGuvl", sizeof(OUTPUT) - sizeof((char)'\0')), INVALID_BASE58_SIZE);
+			
+			// Assert decoding output into a result that's too small fails
+			assert_int_equal(base58Decode(input, sizeof(INPUT) - 1, OUTPUT, sizeof(OUTPUT) - sizeof((char)'\0')), INVALID_BASE58_SIZE);
+			
+			// Assert decoding output with checksum that has an invalid checksum fails
+			assert_int_equal(base58DecodeWithChecksum(input, sizeof(input), "19ESLFKrNZg8HVyyiiAmhXMriiCbREoNCY4", sizeof(OUTPUT_WITH_CHECKSUM) - sizeof((char)'\0')), INVALID_BASE58_SIZE);
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
@@ -33,6 +33,27 @@ static const uint8_t TAG[] = {0xE1, 0x4E, 0x5B, 0x71, 0x8D, 0xBF, 0x28, 0x27, 0x
 // Resulting state
 static const uint32_t RESULTING_STATE[] = {0xF21449CE, 0x56DB77AB, 0x8E746008, 0x3A5E31C2, 0xC20FDB13, 0x6D1966A2, 0x153D274D, 0xC910399F, 0x4A46A8CF, 0xA57954F9, 0x5AC28FC, 0xC2682DE6, 0xB4850F1D, 0xE7F9EF29, 0x40EA2006, 0xDFAC72F2};
 
+// RFC 8439 key
+static const uint8_t RFC_8439_KEY[] = {0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8A, 0x8B, 0x8C, 0x8D, 0x8E, 0x8F, 0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0x9B, 0x9C, 0x9D, 0x9E, 0x9F};
+
+// RFC 8439 nonce
+static const uint8_t RFC_8439_NONCE[] = {0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+
+// RFC 8439 additional authenticated data
+static const uint8_t RFC_8439_ADDITIONAL_AUTHENTICATED_DATA[] = {0x50, 0x51, 0x52, 0x53, 0xC0, 0xC1, 0xC2, 0xC3, 0xC4, 0xC5, 0xC6, 0xC7};
+
+// RFC 8439 counter
+static const uint32_t RFC_8439_COUNTER = 0;
+
+// RFC 8439 data
+static const uint8_t RFC_8439_DATA[] = {0x4C, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61, 0x6E, 0x64, 0x20, 0x47, 0x65, 0x6E, 0x74, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x27, 0x39, 0x39, 0x3A, 0x20, 0x49, 0x66, 0x20, 0x49, 0x20, 0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6F, 0x66, 0x66, 0x65, 0x72, 0x20, 0x79, 0x6F, 0x75, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x74, 0x69, 0x70, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x74, 0x75, 0x72, 0x65, 0x2C, 0x20, 0x73, 0x75, 0x6E, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6E, 0x20, 0x77, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69, 0x74, 0x2E};
+
+// RFC 8439 encrypted data
+static const uint8_t RFC_8439_ENCRYPTED_DATA[] = {0xD3, 0x1A, 0x8D, 0x34, 0x64, 0x8E, 0x60, 0xDB, 0x7B, 0x86, 0xAF, 0xBC, 0x53, 0xEF, 0x7E, 0xC2, 0xA4, 0xAD, 0xED, 0x51, 0x29, 0x6E, 0x08, 0xFE, 0xA9, 0xE2, 0xB5, 0xA7, 0x36, 0xEE, 0x62, 0xD6, 0x3D, 0xBE, 0xA4, 0x5E, 0x8C, 0xA9, 0x67, 0x12, 0x82, 0xFA, 0xFB, 0x69, 0xDA, 0x92, 0x72, 0x8B, 0x1A, 0x71, 0xDE, 0x0A, 0x9E, 0x06, 0x0B, 0x29, 0x05, 0xD6, 0xA5, 0xB6, 0x7E, 0xCD, 0x3B, 0x36, 0x92, 0xDD, 0xBD, 0x7F, 0x2D, 0x77, 0x8B, 0x8C, 0x98, 0x03, 0xAE, 0xE3, 0x28, 0x09, 0x1B, 0x58, 0xFA, 0xB3, 0x24, 0xE4, 0xFA, 0xD6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8B, 0x48, 0x31, 0xD7, 0xBC, 0x3F, 0xF4, 0xDE, 0xF0, 0x8E, 0x4B, 0x7A, 0x9D, 0xE5, 0x76, 0xD2, 0x65, 0x86, 0xCE, 0xC6, 0x4B, 0x61, 0x16};
+
+// RFC 8439 tag
+static const uint8_t RFC_8439_TAG[] = {0x1A, 0xE1, 0x0B, 0x59, 0x4F, 0x09, 0xE2, 0x6A, 0x7E, 0x90, 0x2E, 0xCB, 0xD0, 0x60, 0x06, 0x91};
+
 // Function prototypes
 
 // Test encrypt
@@ -44,6 +65,15 @@ static void testDecrypt(void **state);
 // Test resulting state
 static void testResultingState(void **state);
 
+// Test RFC 8439 chunked encrypt
+static void testRfc8439ChunkedEncrypt(void **state);
+
+// Test RFC 8439 chunked decrypt
+static void testRfc8439ChunkedDecrypt(void **state);
+
+// Test multiple blocks
+static void testMultipleBlocks(void **state);
+
 
 // Main function
 int main(void) {
@@ -58,7 +88,16 @@ int main(void) {
 		cmocka_unit_test(testDecrypt),
 		
 		// Test resulting state
-		cmocka_unit_test(testResultingState)
+		cmocka_unit_test(testResultingState),
+		
+		// Test RFC 8439 chunked encrypt
+		cmocka_unit_test(testRfc8439ChunkedEncrypt),
+		
+		// Test RFC 8439 chunked decrypt
+		cmocka_unit_test(testRfc8439ChunkedDecrypt),
+		
+		// Test multiple blocks
+		cmocka_unit_test(testMultipleBlocks)
 	};
 	
 	// Return performing tests
@@ -198,3 +237,171 @@ void testResultingState(void **state) {
 	// End try
 	END_TRY;
 }
+
+// Test RFC 8439 chunked encrypt
+void testRfc8439ChunkedEncrypt(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Initialize ChaCha20 Poly1305 state
+			ChaCha20Poly1305State chaCha20Poly1305State;
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, RFC_8439_KEY, RFC_8439_NONCE, RFC_8439_ADDITIONAL_AUTHENTICATED_DATA, sizeof(RFC_8439_ADDITIONAL_AUTHENTICATED_DATA), RFC_8439_COUNTER, NULL);
+			
+			// Go through all chunks in the data
+			uint8_t encryptedData[sizeof(RFC_8439_DATA)];
+			for(size_t i = 0; i < sizeof(RFC_8439_DATA); i += CHACHA20_BLOCK_SIZE) {
+			
+				// Encrypt the chunk
+				encryptChaCha20Poly1305Data(&chaCha20Poly1305State, &encryptedData[i], &RFC_8439_DATA[i], MIN(sizeof(RFC_8439_DATA) - i, CHACHA20_BLOCK_SIZE));
+			}
+			
+			// Assert encrypted data is correct
+			assert_memory_equal(encryptedData, RFC_8439_ENCRYPTED_DATA, sizeof(RFC_8439_ENCRYPTED_DATA));
+			
+			// Get tag
+			uint8_t tag[POLY1305_TAG_SIZE];
+			getChaCha20Poly1305Tag(&chaCha20Poly1305State, tag);
+			
+			// Assert tag is correct
+			assert_memory_equal(tag, RFC_8439_TAG, sizeof(RFC_8439_TAG));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Test RFC 8439 chunked decrypt
+void testRfc8439ChunkedDecrypt(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Initialize ChaCha20 Poly1305 state
+			ChaCha20Poly1305State chaCha20Poly1305State;
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, RFC_8439_KEY, RFC_8439_NONCE, RFC_8439_ADDITIONAL_AUTHENTICATED_DATA, sizeof(RFC_8439_ADDITIONAL_AUTHENTICATED_DATA), RFC_8439_COUNTER, NULL);
+			
+			// Go through all chunks in the encrypted data
+			uint8_t data[sizeof(RFC_8439_ENCRYPTED_DATA)];
+			for(size_t i = 0; i < sizeof(RFC_8439_ENCRYPTED_DATA); i += CHACHA20_BLOCK_SIZE) {
+			
+				// Decrypt the chunk
+				decryptChaCha20Poly1305Data(&chaCha20Poly1305State, &data[i], &RFC_8439_ENCRYPTED_DATA[i], MIN(sizeof(RFC_8439_ENCRYPTED_DATA) - i, CHACHA20_BLOCK_SIZE));
+			}
+			
+			// Assert data is correct
+			assert_memory_equal(data, RFC_8439_DATA, sizeof(RFC_8439_DATA));
+			
+			// Get tag
+			uint8_t tag[POLY1305_TAG_SIZE];
+			getChaCha20Poly1305Tag(&chaCha20Poly1305State, tag);
+			
+			// Assert tag is correct
+			assert_memory_equal(tag, RFC_8439_TAG, sizeof(RFC_8439_TAG));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Test multiple blocks
+void testMultipleBlocks(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Create data that spans more blocks than are computed in parallel
+			uint8_t data[CHACHA20_BLOCK_SIZE * 9 + 30];
+			for(size_t i = 0; i < sizeof(data); ++i) {
+			
+				// Set data byte
+				data[i] = i;
+			}
+			
+			// Encrypt the data one block at a time
+			ChaCha20Poly1305State chaCha20Poly1305State;
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, KEY, NONCE, ADDITIONAL_AUTHENTICATED_DATA, sizeof(ADDITIONAL_AUTHENTICATED_DATA), COUNTER, NULL);
+			uint8_t expectedEncryptedData[sizeof(data)];
+			for(size_t i = 0; i < sizeof(data); i += CHACHA20_BLOCK_SIZE) {
+			
+				// Encrypt the block
+				encryptChaCha20Poly1305Data(&chaCha20Poly1305State, &expectedEncryptedData[i], &data[i], MIN(sizeof(data) - i, CHACHA20_BLOCK_SIZE));
+			}
+			
+			// Get expected tag
+			uint8_t expectedTag[POLY1305_TAG_SIZE];
+			getChaCha20Poly1305Tag(&chaCha20Poly1305State, expectedTag);
+			
+			// Encrypt the data all at once
+			initializeChaCha20Poly1305(&chaCha20Poly1305State, KEY, NONCE, ADDITIONAL_AUTHENTICATED_DATA, sizeof(ADDITIONAL_AUTHENTICATED_DATA), COUNTER, NULL);
+			uint8_t encryptedData[sizeof(data)];
+			encryptChaCha20Poly1305Data(&chaCha20Poly1305State, encryptedData, data, sizeof(data));
+			
+			// Assert encrypted data is correct
+			assert_memory_equal(encryptedData, expectedEncryptedData, sizeof(expectedEncryptedData));
+			
+			// Get tag
+			uint8_t tag[POLY1305_TAG_SIZE];
+			getChaCha20Poly1305Tag(&chaCha20Poly1305State, tag);
+			
+			// Assert tag is correct
+			assert_memory_equal(tag, expectedTag, sizeof(expectedTag));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
\ No newline at end of file
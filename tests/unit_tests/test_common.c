@@ -59,6 +59,9 @@ static void testSwapEndianness(void **state);
 // Test to hex string
 static void testToHexString(void **state);
 
+// Test add hex string to hash
+static void testAddHexStringToHash(void **state);
+
 // Test to string
 static void testToString(void **state);
 
@@ -87,6 +90,9 @@ int main(void) {
 		// Test to hex string
 		cmocka_unit_test(testToHexString),
 		
+		// Test add hex string to hash
+		cmocka_unit_test(testAddHexStringToHash),
+		
 		// Test to string
 		cmocka_unit_test(testToString),
 		
@@ -184,6 +190,57 @@ void testToHexString(void **state) {
 	END_TRY;
 }
 
+// Test add hex string to hash
+void testAddHexStringToHash(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Get value that's larger than the hex string hash buffer
+			uint8_t value[sizeof(HEX_VALUE) * 10 + 1];
+			for(size_t i = 0; i < sizeof(value); ++i) {
+				value[i] = HEX_VALUE[i % sizeof(HEX_VALUE)] + i;
+			}
+			
+			// Get expected hash by hashing the value as a string
+			char valueString[sizeof(value) * HEXADECIMAL_CHARACTER_SIZE];
+			toHexString(valueString, value, sizeof(value));
+			uint8_t expectedHash[CX_SHA256_SIZE];
+			cx_hash_sha256((uint8_t *)valueString, sizeof(valueString), expectedHash, sizeof(expectedHash));
+			
+			// Get hash by adding the value as a hex string to the hash
+			cx_sha256_t hash;
+			CX_THROW(cx_sha256_init_no_throw(&hash));
+			addHexStringToHash((cx_hash_t *)&hash, value, sizeof(value));
+			uint8_t result[CX_SHA256_SIZE];
+			CX_THROW(cx_hash_no_throw((cx_hash_t *)&hash, CX_LAST, NULL, 0, result, sizeof(result)));
+			
+			// Assert hash is correct
+			assert_memory_equal(result, expectedHash, sizeof(expectedHash));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
 // Test to string
 void testToString(void **state) {
 
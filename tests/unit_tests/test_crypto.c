@@ -0,0 +1,323 @@
+// Header files
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+#include "common.h"
+#include "crypto.h"
+
+
+// Definitions
+
+// Number of random components
+#define NUMBER_OF_RANDOM_COMPONENTS 1000
+
+
+// Constants
+
+// Secp256k1 curve prime
+static const uint8_t SECP256K1_CURVE_PRIME[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x2F};
+
+// Secp256k1 curve Legendre exponent
+static const uint8_t SECP256K1_CURVE_LEGENDRE_EXPONENT[] = {0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xFF, 0xFE, 0x17};
+
+// Quadratic residue components
+static const uint8_t QUADRATIC_RESIDUE_COMPONENTS[][PUBLIC_KEY_COMPONENT_SIZE] = {
+
+	// Zero
+	{0},
+
+	// One
+	{[PUBLIC_KEY_COMPONENT_SIZE - 1] = 1},
+
+	// Two
+	{[PUBLIC_KEY_COMPONENT_SIZE - 1] = 2},
+
+	// Four
+	{[PUBLIC_KEY_COMPONENT_SIZE - 1] = 4},
+
+	// Generator G's y component
+	{0x48, 0x3A, 0xDA, 0x77, 0x26, 0xA3, 0xC4, 0x65, 0x5D, 0xA4, 0xFB, 0xFC, 0x0E, 0x11, 0x08, 0xA8, 0xFD, 0x17, 0xB4, 0x48, 0xA6, 0x85, 0x54, 0x19, 0x9C, 0x47, 0xD0, 0x8F, 0xFB, 0x10, 0xD4, 0xB8}
+};
+
+// Quadratic nonresidue components
+static const uint8_t QUADRATIC_NONRESIDUE_COMPONENTS[][PUBLIC_KEY_COMPONENT_SIZE] = {
+
+	// Three
+	{[PUBLIC_KEY_COMPONENT_SIZE - 1] = 3},
+
+	// Secp256k1 curve prime minus one
+	{0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x2E},
+
+	// Negated generator G's y component
+	{0xB7, 0xC5, 0x25, 0x88, 0xD9, 0x5C, 0x3B, 0x9A, 0xA2, 0x5B, 0x04, 0x03, 0xF1, 0xEE, 0xF7, 0x57, 0x02, 0xE8, 0x4B, 0xB7, 0x59, 0x7A, 0xAB, 0xE6, 0x63, 0xB8, 0x2F, 0x6F, 0x04, 0xEF, 0x27, 0x77}
+};
+
+// Even generator G public key
+static const uint8_t EVEN_GENERATOR_G_PUBLIC_KEY[] = {0x02, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98};
+
+// Odd generator G public key
+static const uint8_t ODD_GENERATOR_G_PUBLIC_KEY[] = {0x03, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98};
+
+// Uncompressed generator G public key
+static const uint8_t UNCOMPRESSED_GENERATOR_G_PUBLIC_KEY[] = {0x04, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98, 0x48, 0x3A, 0xDA, 0x77, 0x26, 0xA3, 0xC4, 0x65, 0x5D, 0xA4, 0xFB, 0xFC, 0x0E, 0x11, 0x08, 0xA8, 0xFD, 0x17, 0xB4, 0x48, 0xA6, 0x85, 0x54, 0x19, 0x9C, 0x47, 0xD0, 0x8F, 0xFB, 0x10, 0xD4, 0xB8};
+
+// Uncompressed negated generator G public key
+static const uint8_t UNCOMPRESSED_NEGATED_GENERATOR_G_PUBLIC_KEY[] = {0x04, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98, 0xB7, 0xC5, 0x25, 0x88, 0xD9, 0x5C, 0x3B, 0x9A, 0xA2, 0x5B, 0x04, 0x03, 0xF1, 0xEE, 0xF7, 0x57, 0x02, 0xE8, 0x4B, 0xB7, 0x59, 0x7A, 0xAB, 0xE6, 0x63, 0xB8, 0x2F, 0x6F, 0x04, 0xEF, 0x27, 0x77};
+
+// Not on curve public key
+static const uint8_t NOT_ON_CURVE_PUBLIC_KEY[] = {0x02, [COMPRESSED_PUBLIC_KEY_SIZE - 1] = 5};
+
+// Invalid prefix public key
+static const uint8_t INVALID_PREFIX_PUBLIC_KEY[] = {0x04, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98};
+
+// Session cipher key
+static const uint8_t SESSION_CIPHER_KEY[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F};
+
+// Overflowing public key
+static const uint8_t OVERFLOWING_PUBLIC_KEY[] = {0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+
+
+// Function prototypes
+
+// Test is quadratic residue
+static void testIsQuadraticResidue(void **state);
+
+// Test is valid secp256k1 public key
+static void testIsValidSecp256k1PublicKey(void **state);
+
+// Test uncompress secp256k1 public key
+static void testUncompressSecp256k1PublicKey(void **state);
+
+// Test encrypt session cipher data
+static void testEncryptSessionCipherData(void **state);
+
+
+// Main function
+int main(void) {
+
+	// Initialize tests
+	const struct CMUnitTest tests[] = {
+	
+		// Test is quadratic residue
+		cmocka_unit_test(testIsQuadraticResidue),
+		
+		// Test is valid secp256k1 public key
+		cmocka_unit_test(testIsValidSecp256k1PublicKey),
+		
+		// Test uncompress secp256k1 public key
+		cmocka_unit_test(testUncompressSecp256k1PublicKey),
+		
+		// Test encrypt session cipher data
+		cmocka_unit_test(testEncryptSessionCipherData)
+	};
+	
+	// Return performing tests
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
+
+
+// Supporting function implementation
+
+// Test is quadratic residue
+void testIsQuadraticResidue(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Go through all quadratic residue components
+			for(size_t i = 0; i < ARRAYLEN(QUADRATIC_RESIDUE_COMPONENTS); ++i) {
+			
+				// Assert component is quadratic residue
+				assert_true(isQuadraticResidue(QUADRATIC_RESIDUE_COMPONENTS[i]));
+			}
+			
+			// Go through all quadratic nonresidue components
+			for(size_t i = 0; i < ARRAYLEN(QUADRATIC_NONRESIDUE_COMPONENTS); ++i) {
+			
+				// Assert component isn't quadratic residue
+				assert_false(isQuadraticResidue(QUADRATIC_NONRESIDUE_COMPONENTS[i]));
+			}
+			
+			// Go through all random components
+			uint8_t component[PUBLIC_KEY_COMPONENT_SIZE] = {0};
+			for(size_t i = 0; i < NUMBER_OF_RANDOM_COMPONENTS; ++i) {
+			
+				// Get component as the hash of the previous component
+				cx_hash_sha256(component, sizeof(component), component, sizeof(component));
+				
+				// Get the component's Legendre symbol using Euler's criterion
+				uint8_t legendreSymbol[PUBLIC_KEY_COMPONENT_SIZE];
+				assert_int_equal(cx_math_powm_no_throw(legendreSymbol, component, SECP256K1_CURVE_LEGENDRE_EXPONENT, sizeof(SECP256K1_CURVE_LEGENDRE_EXPONENT), SECP256K1_CURVE_PRIME, sizeof(legendreSymbol)), CX_OK);
+				
+				// Assert component is quadratic residue if its Legendre symbol isn't negative one
+				const uint8_t one[PUBLIC_KEY_COMPONENT_SIZE] = {[PUBLIC_KEY_COMPONENT_SIZE - 1] = 1};
+				assert_int_equal(isQuadraticResidue(component), !memcmp(legendreSymbol, one, sizeof(one)) || isZeroArraySecure(legendreSymbol, sizeof(legendreSymbol)));
+			}
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Test is valid secp256k1 public key
+void testIsValidSecp256k1PublicKey(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Assert valid public keys are valid
+			assert_true(isValidSecp256k1PublicKey(EVEN_GENERATOR_G_PUBLIC_KEY, sizeof(EVEN_GENERATOR_G_PUBLIC_KEY)));
+			assert_true(isValidSecp256k1PublicKey(ODD_GENERATOR_G_PUBLIC_KEY, sizeof(ODD_GENERATOR_G_PUBLIC_KEY)));
+			
+			// Assert invalid public keys are invalid
+			assert_false(isValidSecp256k1PublicKey(NOT_ON_CURVE_PUBLIC_KEY, sizeof(NOT_ON_CURVE_PUBLIC_KEY)));
+			assert_false(isValidSecp256k1PublicKey(INVALID_PREFIX_PUBLIC_KEY, sizeof(INVALID_PREFIX_PUBLIC_KEY)));
+			assert_false(isValidSecp256k1PublicKey(OVERFLOWING_PUBLIC_KEY, sizeof(OVERFLOWING_PUBLIC_KEY)));
+			assert_false(isValidSecp256k1PublicKey(EVEN_GENERATOR_G_PUBLIC_KEY, sizeof(EVEN_GENERATOR_G_PUBLIC_KEY) - 1));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Test uncompress secp256k1 public key
+void testUncompressSecp256k1PublicKey(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Uncompress even public key
+			uint8_t publicKey[UNCOMPRESSED_PUBLIC_KEY_SIZE];
+			memcpy(publicKey, EVEN_GENERATOR_G_PUBLIC_KEY, sizeof(EVEN_GENERATOR_G_PUBLIC_KEY));
+			
+			// Assert public key's y component is quadratic residue
+			assert_true(uncompressSecp256k1PublicKey(publicKey));
+			
+			// Assert public key is correct
+			assert_memory_equal(publicKey, UNCOMPRESSED_GENERATOR_G_PUBLIC_KEY, sizeof(UNCOMPRESSED_GENERATOR_G_PUBLIC_KEY));
+			
+			// Uncompress odd public key
+			memcpy(publicKey, ODD_GENERATOR_G_PUBLIC_KEY, sizeof(ODD_GENERATOR_G_PUBLIC_KEY));
+			
+			// Assert public key's y component isn't quadratic residue
+			assert_false(uncompressSecp256k1PublicKey(publicKey));
+			
+			// Assert public key is correct
+			assert_memory_equal(publicKey, UNCOMPRESSED_NEGATED_GENERATOR_G_PUBLIC_KEY, sizeof(UNCOMPRESSED_NEGATED_GENERATOR_G_PUBLIC_KEY));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
+
+// Test encrypt session cipher data
+void testEncryptSessionCipherData(void **state) {
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Create data
+			uint8_t data[CX_AES_BLOCK_SIZE * 5 + 3];
+			for(size_t i = 0; i < sizeof(data); ++i) {
+			
+				// Set byte to its index
+				data[i] = i;
+			}
+			
+			// Encrypt the data all at once
+			uint8_t expectedResult[sizeof(data) + CX_AES_BLOCK_SIZE - 3];
+			assert_int_equal(getEncryptedDataLength(sizeof(data)), sizeof(expectedResult));
+			encryptData(expectedResult, data, sizeof(data), SESSION_CIPHER_KEY, sizeof(SESSION_CIPHER_KEY));
+			
+			// Initialize session cipher
+			struct SessionCipher sessionCipher;
+			initializeSessionCipher(&sessionCipher, SESSION_CIPHER_KEY, sizeof(SESSION_CIPHER_KEY));
+			
+			// Encrypt the data in chunks with the session cipher
+			uint8_t result[sizeof(expectedResult)];
+			assert_int_equal(getSessionCipherEncryptedDataLength(CX_AES_BLOCK_SIZE, false), CX_AES_BLOCK_SIZE);
+			encryptSessionCipherData(&sessionCipher, result, data, CX_AES_BLOCK_SIZE, false);
+			encryptSessionCipherData(&sessionCipher, &result[CX_AES_BLOCK_SIZE], &data[CX_AES_BLOCK_SIZE], CX_AES_BLOCK_SIZE * 3, false);
+			assert_int_equal(getSessionCipherEncryptedDataLength(CX_AES_BLOCK_SIZE + 3, true), CX_AES_BLOCK_SIZE * 2);
+			encryptSessionCipherData(&sessionCipher, &result[CX_AES_BLOCK_SIZE * 4], &data[CX_AES_BLOCK_SIZE * 4], CX_AES_BLOCK_SIZE + 3, true);
+			
+			// Assert result is correct
+			assert_memory_equal(result, expectedResult, sizeof(expectedResult));
+		}
+
+		// Catch all errors
+		CATCH_ALL {
+
+			// Close try
+			CLOSE_TRY;
+
+			// Fail test
+			assert_true(false);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+}
@@ -0,0 +1,100 @@
+// Header files
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+#include <string.h>
+#include "common.h"
+#include "root_public_key_cache.h"
+
+
+// Constants
+
+// Account
+static const uint32_t ACCOUNT = 0;
+
+// Root public key
+static const uint8_t ROOT_PUBLIC_KEY[COMPRESSED_PUBLIC_KEY_SIZE] = {0x03, 0x2E, 0x5C, 0x92, 0x2D, 0xC4, 0x3E, 0x77, 0x0C, 0xB0, 0xAA, 0x1C, 0x3E, 0x55, 0xF5, 0x22, 0x85, 0x6C, 0x8F, 0x3D, 0x2B, 0x17, 0x66, 0xB1, 0x09, 0x3A, 0xC0, 0x4B, 0xD7, 0x5D, 0x88, 0xE2, 0x41};
+
+
+// Function prototypes
+
+// Test get cached root public key
+static void testGetCachedRootPublicKey(void **state);
+
+// Test least recently used eviction
+static void testLeastRecentlyUsedEviction(void **state);
+
+
+// Main function
+int main(void) {
+
+	// Initialize tests
+	const struct CMUnitTest tests[] = {
+	
+		// Test get cached root public key
+		cmocka_unit_test(testGetCachedRootPublicKey),
+		
+		// Test least recently used eviction
+		cmocka_unit_test(testLeastRecentlyUsedEviction)
+	};
+	
+	// Return performing tests
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
+
+
+// Supporting function implementation
+
+// Test get cached root public key
+void testGetCachedRootPublicKey(void **state) {
+
+	// Reset root public key cache
+	resetRootPublicKeyCache();
+	
+	// Assert root public key isn't cached
+	uint8_t rootPublicKey[COMPRESSED_PUBLIC_KEY_SIZE];
+	assert_false(getCachedRootPublicKey(rootPublicKey, ACCOUNT));
+	
+	// Cache root public key
+	cacheRootPublicKey(ROOT_PUBLIC_KEY, ACCOUNT);
+	
+	// Assert root public key is cached
+	assert_true(getCachedRootPublicKey(rootPublicKey, ACCOUNT));
+	assert_memory_equal(rootPublicKey, ROOT_PUBLIC_KEY, sizeof(ROOT_PUBLIC_KEY));
+	
+	// Assert root public key isn't cached for a different account
+	assert_false(getCachedRootPublicKey(rootPublicKey, ACCOUNT + 1));
+	
+	// Reset root public key cache
+	resetRootPublicKeyCache();
+	
+	// Assert root public key isn't cached
+	assert_false(getCachedRootPublicKey(rootPublicKey, ACCOUNT));
+}
+
+// Test least recently used eviction
+void testLeastRecentlyUsedEviction(void **state) {
+
+	// Reset root public key cache
+	resetRootPublicKeyCache();
+	
+	// Go through all entries in the root public key cache
+	for(uint32_t i = 0; i < NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES; ++i) {
+	
+		// Cache root public key for the account
+		cacheRootPublicKey(ROOT_PUBLIC_KEY, i);
+	}
+	
+	// Use the root public key for the first account
+	uint8_t rootPublicKey[COMPRESSED_PUBLIC_KEY_SIZE];
+	assert_true(getCachedRootPublicKey(rootPublicKey, 0));
+	
+	// Cache root public key for another account
+	cacheRootPublicKey(ROOT_PUBLIC_KEY, NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES);
+	
+	// Assert the least recently used root public key was evicted
+	assert_true(getCachedRootPublicKey(rootPublicKey, 0));
+	assert_false(getCachedRootPublicKey(rootPublicKey, 1));
+	assert_true(getCachedRootPublicKey(rootPublicKey, NUMBER_OF_ROOT_PUBLIC_KEY_CACHE_ENTRIES));
+}
@@ -0,0 +1,148 @@
+// Header files
+#include <setjmp.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <cmocka.h>
+#include <string.h>
+#include "common.h"
+#include "shared_secret_cache.h"
+
+
+// Constants
+
+// Account
+static const uint32_t ACCOUNT = 0;
+
+// Index
+static const uint32_t INDEX = 1;
+
+// Address
+static const char ADDRESS[] = "xmj6hXXLjKEhEqWPHEDB9hvtgTtfsLAh9AUsyFeYvRiMWsjFJeCR";
+
+// Other address
+static const char OTHER_ADDRESS[] = "xmgEvZ4MCCGMJnRnNXKHBbHmSGWQchNr9uZpY5J1XXnsCFS45fsU";
+
+// Secret
+static const uint8_t SECRET[SHARED_SECRET_CACHE_SECRET_SIZE] = {0x2E, 0x5C, 0x92, 0x2D, 0xC4, 0x3E, 0x77, 0x0C, 0xB0, 0xAA, 0x1C, 0x3E, 0x55, 0xF5, 0x22, 0x85, 0x6C, 0x8F, 0x3D, 0x2B, 0x17, 0x66, 0xB1, 0x09, 0x3A, 0xC0, 0x4B, 0xD7, 0x5D, 0x88, 0xE2, 0x41};
+
+
+// Function prototypes
+
+// Test get cached shared secret
+static void testGetCachedSharedSecret(void **state);
+
+// Test least recently used eviction
+static void testLeastRecentlyUsedEviction(void **state);
+
+// Test inactivity timeout
+static void testInactivityTimeout(void **state);
+
+
+// Main function
+int main(void) {
+
+	// Initialize tests
+	const struct CMUnitTest tests[] = {
+	
+		// Test get cached shared secret
+		cmocka_unit_test(testGetCachedSharedSecret),
+		
+		// Test least recently used eviction
+		cmocka_unit_test(testLeastRecentlyUsedEviction),
+		
+		// Test inactivity timeout
+		cmocka_unit_test(testInactivityTimeout)
+	};
+	
+	// Return performing tests
+	return cmocka_run_group_tests(tests, NULL, NULL);
+}
+
+
+// Supporting function implementation
+
+// Test get cached shared secret
+void testGetCachedSharedSecret(void **state) {
+
+	// Reset shared secret cache
+	resetSharedSecretCache();
+	
+	// Assert secret isn't cached
+	uint8_t secret[SHARED_SECRET_CACHE_SECRET_SIZE];
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	
+	// Cache secret
+	cacheSharedSecret(SECRET, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0'));
+	
+	// Assert secret is cached
+	assert_true(getCachedSharedSecret(secret, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	assert_memory_equal(secret, SECRET, sizeof(SECRET));
+	
+	// Assert secret isn't cached for a different account, index, or address
+	assert_false(getCachedSharedSecret(secret, ACCOUNT + 1, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, INDEX + 1, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, INDEX, OTHER_ADDRESS, sizeof(OTHER_ADDRESS) - sizeof((char)'\0')));
+	
+	// Reset shared secret cache
+	resetSharedSecretCache();
+	
+	// Assert secret isn't cached
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+}
+
+// Test least recently used eviction
+void testLeastRecentlyUsedEviction(void **state) {
+
+	// Reset shared secret cache
+	resetSharedSecretCache();
+	
+	// Go through all entries in the shared secret cache
+	for(uint32_t i = 0; i < NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES; ++i) {
+	
+		// Cache secret for the index
+		cacheSharedSecret(SECRET, ACCOUNT, i, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0'));
+	}
+	
+	// Use the secret for the first index
+	uint8_t secret[SHARED_SECRET_CACHE_SECRET_SIZE];
+	assert_true(getCachedSharedSecret(secret, ACCOUNT, 0, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	
+	// Cache secret for another index
+	cacheSharedSecret(SECRET, ACCOUNT, NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0'));
+	
+	// Assert the least recently used secret was evicted
+	assert_true(getCachedSharedSecret(secret, ACCOUNT, 0, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, 1, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	assert_true(getCachedSharedSecret(secret, ACCOUNT, NUMBER_OF_SHARED_SECRET_CACHE_ENTRIES, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+}
+
+// Test inactivity timeout
+void testInactivityTimeout(void **state) {
+
+	// Reset shared secret cache
+	resetSharedSecretCache();
+	
+	// Cache secret
+	cacheSharedSecret(SECRET, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0'));
+	
+	// Go through all ticks before the timeout
+	for(size_t i = 0; i < SHARED_SECRET_CACHE_TIMEOUT_TICKS - 1; ++i) {
+	
+		// Tick shared secret cache
+		tickSharedSecretCache();
+	}
+	
+	// Assert secret is cached
+	uint8_t secret[SHARED_SECRET_CACHE_SECRET_SIZE];
+	assert_true(getCachedSharedSecret(secret, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+	
+	// Go through all ticks until the timeout
+	for(size_t i = 0; i < SHARED_SECRET_CACHE_TIMEOUT_TICKS; ++i) {
+	
+		// Tick shared secret cache
+		tickSharedSecretCache();
+	}
+	
+	// Assert secret isn't cached
+	assert_false(getCachedSharedSecret(secret, ACCOUNT, INDEX, ADDRESS, sizeof(ADDRESS) - sizeof((char)'\0')));
+}
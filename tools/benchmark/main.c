@@ -0,0 +1,565 @@
+// Header files
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include "base58.h"
+#include "chacha20_poly1305.h"
+#include "common.h"
+#include "crypto.h"
+#include "simulate.h"
+
+
+// Definitions
+
+// Number of iterations
+#define NUMBER_OF_ITERATIONS 10000
+
+// Slate data size
+#define SLATE_DATA_SIZE (1024 * 1024)
+
+// Slate chunk size
+#define SLATE_CHUNK_SIZE (CHACHA20_BLOCK_SIZE * 16)
+
+// Poly1305 block size
+#define POLY1305_BLOCK_SIZE 16
+
+// Poly1305 number size
+#define POLY1305_NUMBER_SIZE 17
+
+// Base58 data size
+#define BASE58_DATA_SIZE (sizeof((uint8_t[])CURRENCY_MQS_VERSION) + COMPRESSED_PUBLIC_KEY_SIZE + BASE58_CHECKSUM_SIZE)
+
+// Base58 maximum encoded size
+#define BASE58_MAXIMUM_ENCODED_SIZE (BASE58_DATA_SIZE * 138 / 100 + 1)
+
+// Number of derivation iterations
+#define NUMBER_OF_DERIVATION_ITERATIONS (NUMBER_OF_ITERATIONS / 10)
+
+// Number of derivation accounts
+#define NUMBER_OF_DERIVATION_ACCOUNTS 4
+
+// Derivation seed
+#define DERIVATION_SEED "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about"
+
+
+// Constants
+
+// Secp256k1 curve prime
+static const uint8_t SECP256K1_CURVE_PRIME[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFC, 0x2F};
+
+// Secp256k1 curve square root exponent
+static const uint8_t SECP256K1_CURVE_SQUARE_ROOT_EXPONENT[] = {0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0x0C};
+
+// Base58 characters
+static const char BASE58_CHARACTERS[] = "123456789ABCDEFGHJKLMNPQRSTUVWXYZabcdefghijkmnopqrstuvwxyz";
+
+// Poly1305 p
+static const uint8_t POLY1305_P[] = {0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB};
+
+
+// Function prototypes
+
+// Is quadratic residue with exponentiation
+static bool isQuadraticResidueWithExponentiation(const uint8_t *component);
+
+// Benchmark quadratic residue
+static bool benchmarkQuadraticResidue(void);
+
+// Benchmark ChaCha20 Poly1305
+static bool benchmarkChaCha20Poly1305(void);
+
+// Get Poly1305 tag with bignums
+static void getPoly1305TagWithBignums(uint8_t *tag, const uint8_t *key, const uint8_t *additionalAuthenticatedData, const size_t additionalAuthenticatedDataLength, const uint8_t *data, const size_t dataLength);
+
+// Update Poly1305 accumulator with bignums
+static void updatePoly1305AccumulatorWithBignums(uint8_t *accumulator, const uint8_t *r, const uint8_t *value, const size_t valueLength);
+
+// Benchmark base58
+static bool benchmarkBase58(void);
+
+// Base58 encode with bytes
+static size_t base58EncodeWithBytes(char *result, const uint8_t *data, const size_t length);
+
+// Base58 decode with bytes
+static size_t base58DecodeWithBytes(uint8_t *result, const char *data, const size_t length);
+
+// Benchmark root derivation
+static bool benchmarkRootDerivation(void);
+
+// Get elapsed seconds
+static double getElapsedSeconds(const struct timeval *start);
+
+
+// Main function
+int main(void) {
+
+	// Return if all benchmarks succeeded
+	return (benchmarkQuadraticResidue() && benchmarkChaCha20Poly1305() && benchmarkBase58() && benchmarkRootDerivation()) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+
+// Supporting function implementation
+
+// Is quadratic residue with exponentiation
+bool isQuadraticResidueWithExponentiation(const uint8_t *component) {
+
+	// Get the square root of the component
+	uint8_t squareRoot[PUBLIC_KEY_COMPONENT_SIZE];
+	if(cx_math_powm_no_throw(squareRoot, component, SECP256K1_CURVE_SQUARE_ROOT_EXPONENT, sizeof(SECP256K1_CURVE_SQUARE_ROOT_EXPONENT), SECP256K1_CURVE_PRIME, sizeof(squareRoot)) != CX_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Get the square of the square root
+	uint8_t square[PUBLIC_KEY_COMPONENT_SIZE];
+	if(cx_math_multm_no_throw(square, squareRoot, squareRoot, SECP256K1_CURVE_PRIME, sizeof(square)) != CX_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Return if the square is the component
+	return !memcmp(square, component, sizeof(square));
+}
+
+// Benchmark quadratic residue
+bool benchmarkQuadraticResidue(void) {
+
+	// Create components
+	static uint8_t components[NUMBER_OF_ITERATIONS][PUBLIC_KEY_COMPONENT_SIZE];
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Set component to the hash of the index
+		cx_hash_sha256((const uint8_t *)&i, sizeof(i), components[i], sizeof(components[i]));
+	}
+	
+	// Display message
+	printf("Benchmarking isQuadraticResidue with %d components\n", NUMBER_OF_ITERATIONS);
+	
+	// Go through all components
+	size_t jacobiResidues = 0;
+	struct timeval start;
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Check if component is a quadratic residue
+		if(isQuadraticResidue(components[i])) {
+		
+			// Increment Jacobi residues
+			++jacobiResidues;
+		}
+	}
+	
+	// Display time
+	const double jacobiSeconds = getElapsedSeconds(&start);
+	printf("Jacobi symbol: %f seconds\n", jacobiSeconds);
+	
+	// Go through all components
+	size_t exponentiationResidues = 0;
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Check if component is a quadratic residue
+		if(isQuadraticResidueWithExponentiation(components[i])) {
+		
+			// Increment exponentiation residues
+			++exponentiationResidues;
+		}
+	}
+	
+	// Display time
+	const double exponentiationSeconds = getElapsedSeconds(&start);
+	printf("Exponentiation: %f seconds\n", exponentiationSeconds);
+	
+	// Check if results differ
+	if(jacobiResidues != exponentiationResidues) {
+	
+		// Display message
+		printf("Benchmark failed: results differ\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Display speedup
+	printf("Speedup: %fx\n", exponentiationSeconds / jacobiSeconds);
+	
+	// Return true
+	return true;
+}
+
+// Benchmark ChaCha20 Poly1305
+bool benchmarkChaCha20Poly1305(void) {
+
+	// Create key, nonce, additional authenticated data, and data
+	const uint8_t key[32] = {1};
+	const uint8_t nonce[CHACHA20_NONCE_SIZE] = {2};
+	const uint8_t additionalAuthenticatedData[] = {3, 4, 5};
+	static uint8_t data[SLATE_DATA_SIZE];
+	static uint8_t encryptedData[SLATE_DATA_SIZE];
+	for(size_t i = 0; i < sizeof(data); ++i) {
+	
+		// Set data byte
+		data[i] = i;
+	}
+	
+	// Display message
+	printf("Benchmarking ChaCha20 Poly1305 with %d bytes\n", SLATE_DATA_SIZE);
+	
+	// Go through all chunks in the data
+	struct timeval start;
+	gettimeofday(&start, NULL);
+	ChaCha20Poly1305State chaCha20Poly1305State;
+	initializeChaCha20Poly1305(&chaCha20Poly1305State, key, nonce, additionalAuthenticatedData, sizeof(additionalAuthenticatedData), 0, NULL);
+	for(size_t i = 0; i < sizeof(data); i += SLATE_CHUNK_SIZE) {
+	
+		// Encrypt chunk
+		encryptChaCha20Poly1305Data(&chaCha20Poly1305State, &encryptedData[i], &data[i], SLATE_CHUNK_SIZE);
+	}
+	
+	// Get tag
+	uint8_t tag[POLY1305_TAG_SIZE];
+	getChaCha20Poly1305Tag(&chaCha20Poly1305State, tag);
+	
+	// Display time
+	const double limbsSeconds = getElapsedSeconds(&start);
+	printf("ChaCha20 Poly1305 with limbs: %f seconds (%f MiB/s)\n", limbsSeconds, SLATE_DATA_SIZE / limbsSeconds / (1024 * 1024));
+	
+	// Get Poly1305 key
+	uint32_t chaCha20ResultingState[CHACHA20_STATE_SIZE];
+	initializeChaCha20Poly1305(&chaCha20Poly1305State, key, nonce, additionalAuthenticatedData, sizeof(additionalAuthenticatedData), 0, chaCha20ResultingState);
+	
+	// Get Poly1305 tag with bignums
+	uint8_t bignumsTag[POLY1305_TAG_SIZE];
+	gettimeofday(&start, NULL);
+	getPoly1305TagWithBignums(bignumsTag, (uint8_t *)chaCha20ResultingState, additionalAuthenticatedData, sizeof(additionalAuthenticatedData), encryptedData, sizeof(encryptedData));
+	
+	// Display time
+	const double bignumsSeconds = getElapsedSeconds(&start);
+	printf("Poly1305 alone with bignums: %f seconds (%f MiB/s)\n", bignumsSeconds, SLATE_DATA_SIZE / bignumsSeconds / (1024 * 1024));
+	
+	// Check if tags differ
+	if(memcmp(tag, bignumsTag, sizeof(tag))) {
+	
+		// Display message
+		printf("Benchmark failed: tags differ\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Display speedup
+	printf("Speedup: at least %fx\n", bignumsSeconds / limbsSeconds);
+	
+	// Return true
+	return true;
+}
+
+// Get Poly1305 tag with bignums
+void getPoly1305TagWithBignums(uint8_t *tag, const uint8_t *key, const uint8_t *additionalAuthenticatedData, const size_t additionalAuthenticatedDataLength, const uint8_t *data, const size_t dataLength) {
+
+	// Set r to the clamped first part of the key
+	uint8_t r[POLY1305_NUMBER_SIZE] = {0};
+	memcpy(r, key, POLY1305_BLOCK_SIZE);
+	r[3] &= 15;
+	r[7] &= 15;
+	r[11] &= 15;
+	r[15] &= 15;
+	r[4] &= 252;
+	r[8] &= 252;
+	r[12] &= 252;
+	swapEndianness(r, sizeof(r));
+	
+	// Set s to the second part of the key
+	uint8_t s[POLY1305_NUMBER_SIZE] = {0};
+	memcpy(s, &key[POLY1305_BLOCK_SIZE], POLY1305_BLOCK_SIZE);
+	swapEndianness(s, sizeof(s));
+	
+	// Update accumulator with the additional authenticated data, data, and lengths
+	uint8_t accumulator[POLY1305_NUMBER_SIZE] = {0};
+	updatePoly1305AccumulatorWithBignums(accumulator, r, additionalAuthenticatedData, additionalAuthenticatedDataLength);
+	updatePoly1305AccumulatorWithBignums(accumulator, r, data, dataLength);
+	const uint64_t lengths[] = {additionalAuthenticatedDataLength, dataLength};
+	updatePoly1305AccumulatorWithBignums(accumulator, r, (const uint8_t *)lengths, sizeof(lengths));
+	
+	// Add s to the accumulator
+	cx_math_add(accumulator, accumulator, s, sizeof(accumulator));
+	
+	// Set tag to the accumulator
+	swapEndianness(accumulator, sizeof(accumulator));
+	memcpy(tag, accumulator, POLY1305_TAG_SIZE);
+}
+
+// Update Poly1305 accumulator with bignums
+void updatePoly1305AccumulatorWithBignums(uint8_t *accumulator, const uint8_t *r, const uint8_t *value, const size_t valueLength) {
+
+	// Go through all blocks in the value
+	for(size_t i = 0; i < valueLength; i += POLY1305_BLOCK_SIZE) {
+	
+		// Copy block to padded block and set the highest byte to one
+		uint8_t block[POLY1305_NUMBER_SIZE] = {
+			[POLY1305_NUMBER_SIZE - 1] = 1,
+		};
+		memcpy(block, &value[i], MIN(valueLength - i, POLY1305_BLOCK_SIZE));
+		swapEndianness(block, sizeof(block));
+		
+		// Add block to the accumulator and multiply it by r modulo p
+		cx_math_add(accumulator, accumulator, block, POLY1305_NUMBER_SIZE);
+		cx_math_multm_no_throw(accumulator, accumulator, r, POLY1305_P, POLY1305_NUMBER_SIZE);
+	}
+}
+
+// Benchmark base58
+bool benchmarkBase58(void) {
+
+	// Create data
+	static uint8_t data[NUMBER_OF_ITERATIONS][BASE58_DATA_SIZE];
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Set data to the version followed by the hash of the index
+		uint8_t hash[CX_SHA256_SIZE + CX_SHA256_SIZE];
+		cx_hash_sha256((const uint8_t *)&i, sizeof(i), hash, CX_SHA256_SIZE);
+		cx_hash_sha256(hash, CX_SHA256_SIZE, &hash[CX_SHA256_SIZE], CX_SHA256_SIZE);
+		memcpy(data[i], (uint8_t[])CURRENCY_MQS_VERSION, sizeof((uint8_t[])CURRENCY_MQS_VERSION));
+		memcpy(&data[i][sizeof((uint8_t[])CURRENCY_MQS_VERSION)], hash, sizeof(data[i]) - sizeof((uint8_t[])CURRENCY_MQS_VERSION));
+	}
+	
+	// Display message
+	printf("Benchmarking base58 with %d encodes and decodes of %zu bytes\n", NUMBER_OF_ITERATIONS, BASE58_DATA_SIZE);
+	
+	// Go through all data
+	static char encoded[NUMBER_OF_ITERATIONS][BASE58_MAXIMUM_ENCODED_SIZE];
+	static size_t encodedLengths[NUMBER_OF_ITERATIONS];
+	static uint8_t decoded[NUMBER_OF_ITERATIONS][BASE58_DATA_SIZE];
+	struct timeval start;
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Encode and decode the data
+		encodedLengths[i] = base58Encode(encoded[i], data[i], sizeof(data[i]));
+		base58Decode(decoded[i], sizeof(decoded[i]), encoded[i], encodedLengths[i]);
+	}
+	
+	// Display time
+	const double limbsSeconds = getElapsedSeconds(&start);
+	printf("Base58 with limbs: %f seconds\n", limbsSeconds);
+	
+	// Go through all data
+	static char bytesEncoded[NUMBER_OF_ITERATIONS][BASE58_MAXIMUM_ENCODED_SIZE];
+	static size_t bytesEncodedLengths[NUMBER_OF_ITERATIONS];
+	static uint8_t bytesDecoded[NUMBER_OF_ITERATIONS][BASE58_DATA_SIZE];
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_ITERATIONS; ++i) {
+	
+		// Encode and decode the data
+		bytesEncodedLengths[i] = base58EncodeWithBytes(bytesEncoded[i], data[i], sizeof(data[i]));
+		base58DecodeWithBytes(bytesDecoded[i], bytesEncoded[i], bytesEncodedLengths[i]);
+	}
+	
+	// Display time
+	const double bytesSeconds = getElapsedSeconds(&start);
+	printf("Base58 with bytes: %f seconds\n", bytesSeconds);
+	
+	// Check if results differ
+	if(memcmp(encodedLengths, bytesEncodedLengths, sizeof(encodedLengths)) || memcmp(encoded, bytesEncoded, sizeof(encoded)) || memcmp(decoded, data, sizeof(decoded)) || memcmp(bytesDecoded, data, sizeof(bytesDecoded))) {
+	
+		// Display message
+		printf("Benchmark failed: results differ\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Display speedup
+	printf("Speedup: %fx\n", bytesSeconds / limbsSeconds);
+	
+	// Return true
+	return true;
+}
+
+// Base58 encode with bytes
+size_t base58EncodeWithBytes(char *result, const uint8_t *data, const size_t length) {
+
+	// Go through all leading zeros in the data
+	size_t numberOfLeadingZeros = 0;
+	while(numberOfLeadingZeros < length && !data[numberOfLeadingZeros]) {
+	
+		// Increment number of leading zeros
+		++numberOfLeadingZeros;
+	}
+	
+	// Go through all bytes in the data after the leading zeros
+	uint8_t buffer[BASE58_MAXIMUM_ENCODED_SIZE] = {0};
+	size_t bufferLength = 0;
+	for(size_t i = numberOfLeadingZeros; i < length; ++i) {
+	
+		// Go through all base58 digits in the buffer
+		uint32_t carry = data[i];
+		for(size_t j = 0; j < bufferLength; ++j) {
+		
+			// Multiply the digit by the byte base and add the carry to it
+			carry += buffer[j] * (UINT8_MAX + 1);
+			buffer[j] = carry % (sizeof(BASE58_CHARACTERS) - sizeof((char)'\0'));
+			carry /= sizeof(BASE58_CHARACTERS) - sizeof((char)'\0');
+		}
+		
+		// Go through all remaining parts of the carry
+		while(carry) {
+		
+			// Append carry's low part as a new digit
+			buffer[bufferLength++] = carry % (sizeof(BASE58_CHARACTERS) - sizeof((char)'\0'));
+			carry /= sizeof(BASE58_CHARACTERS) - sizeof((char)'\0');
+		}
+	}
+	
+	// Set result to the leading zeros followed by the digits
+	memset(result, BASE58_CHARACTERS[0], numberOfLeadingZeros);
+	for(size_t i = 0; i < bufferLength; ++i) {
+	
+		// Append digit to the result
+		result[numberOfLeadingZeros + i] = BASE58_CHARACTERS[buffer[bufferLength - i - 1]];
+	}
+	
+	// Return result length
+	return numberOfLeadingZeros + bufferLength;
+}
+
+// Base58 decode with bytes
+size_t base58DecodeWithBytes(uint8_t *result, const char *data, const size_t length) {
+
+	// Go through all leading zeros in base58 in the data
+	size_t numberOfLeadingZeros = 0;
+	while(numberOfLeadingZeros < length && data[numberOfLeadingZeros] == BASE58_CHARACTERS[0]) {
+	
+		// Increment number of leading zeros
+		++numberOfLeadingZeros;
+	}
+	
+	// Go through all characters in the data after the leading zeros
+	uint8_t buffer[BASE58_MAXIMUM_ENCODED_SIZE] = {0};
+	size_t bufferLength = 0;
+	for(size_t i = numberOfLeadingZeros; i < length; ++i) {
+	
+		// Go through all bytes in the buffer
+		uint32_t carry = strchr(BASE58_CHARACTERS, data[i]) - BASE58_CHARACTERS;
+		for(size_t j = 0; j < bufferLength; ++j) {
+		
+			// Multiply the byte by the base58 base and add the carry to it
+			carry += buffer[j] * (sizeof(BASE58_CHARACTERS) - sizeof((char)'\0'));
+			buffer[j] = carry;
+			carry >>= BITS_IN_A_BYTE;
+		}
+		
+		// Go through all remaining parts of the carry
+		while(carry) {
+		
+			// Append carry's low part as a new byte
+			buffer[bufferLength++] = carry;
+			carry >>= BITS_IN_A_BYTE;
+		}
+	}
+	
+	// Set result to the leading zeros followed by the bytes
+	memset(result, 0, numberOfLeadingZeros);
+	for(size_t i = 0; i < bufferLength; ++i) {
+	
+		// Append byte to the result
+		result[numberOfLeadingZeros + i] = buffer[bufferLength - i - 1];
+	}
+	
+	// Return result length
+	return numberOfLeadingZeros + bufferLength;
+}
+
+// Benchmark root derivation
+bool benchmarkRootDerivation(void) {
+
+	// Check if setting seed failed
+	if(!setSeedFromString(DERIVATION_SEED)) {
+	
+		// Display message
+		printf("Benchmark failed: setting seed failed\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Display message
+	printf("Benchmarking root derivation with %d derivations of %d accounts\n", NUMBER_OF_DERIVATION_ITERATIONS, NUMBER_OF_DERIVATION_ACCOUNTS);
+	
+	// Go through all iterations without derivation memoisation
+	setDerivationMemoisation(false);
+	static cx_ecfp_private_key_t coldPrivateKeys[NUMBER_OF_DERIVATION_ACCOUNTS];
+	static uint8_t coldChainCodes[NUMBER_OF_DERIVATION_ACCOUNTS][CHAIN_CODE_SIZE];
+	struct timeval start;
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_DERIVATION_ITERATIONS; ++i) {
+	
+		// Get private key and chain code for the account
+		getPrivateKeyAndChainCode(&coldPrivateKeys[i % NUMBER_OF_DERIVATION_ACCOUNTS], coldChainCodes[i % NUMBER_OF_DERIVATION_ACCOUNTS], i % NUMBER_OF_DERIVATION_ACCOUNTS);
+	}
+	
+	// Display time
+	const double coldSeconds = getElapsedSeconds(&start);
+	printf("Root derivation cold: %f seconds\n", coldSeconds);
+	
+	// Go through all iterations with derivation memoisation
+	setDerivationMemoisation(true);
+	static cx_ecfp_private_key_t warmPrivateKeys[NUMBER_OF_DERIVATION_ACCOUNTS];
+	static uint8_t warmChainCodes[NUMBER_OF_DERIVATION_ACCOUNTS][CHAIN_CODE_SIZE];
+	gettimeofday(&start, NULL);
+	for(size_t i = 0; i < NUMBER_OF_DERIVATION_ITERATIONS; ++i) {
+	
+		// Get private key and chain code for the account
+		getPrivateKeyAndChainCode(&warmPrivateKeys[i % NUMBER_OF_DERIVATION_ACCOUNTS], warmChainCodes[i % NUMBER_OF_DERIVATION_ACCOUNTS], i % NUMBER_OF_DERIVATION_ACCOUNTS);
+	}
+	
+	// Display time
+	const double warmSeconds = getElapsedSeconds(&start);
+	printf("Root derivation warm: %f seconds\n", warmSeconds);
+	
+	// Restore seed and disable derivation memoisation
+	setSeed(NULL, 0);
+	setDerivationMemoisation(false);
+	
+	// Go through all accounts
+	bool resultsDiffer = memcmp(coldChainCodes, warmChainCodes, sizeof(coldChainCodes));
+	for(size_t i = 0; i < NUMBER_OF_DERIVATION_ACCOUNTS; ++i) {
+	
+		// Check if account's private keys differ
+		resultsDiffer |= memcmp(coldPrivateKeys[i].d, warmPrivateKeys[i].d, sizeof(coldPrivateKeys[i].d));
+	}
+	
+	// Clear private keys
+	explicit_bzero(coldPrivateKeys, sizeof(coldPrivateKeys));
+	explicit_bzero(warmPrivateKeys, sizeof(warmPrivateKeys));
+	
+	// Check if results differ
+	if(resultsDiffer) {
+	
+		// Display message
+		printf("Benchmark failed: results differ\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Display speedup
+	printf("Speedup: %fx\n", coldSeconds / warmSeconds);
+	
+	// Return true
+	return true;
+}
+
+// Get elapsed seconds
+double getElapsedSeconds(const struct timeval *start) {
+
+	// Get current time
+	struct timeval end;
+	gettimeofday(&end, NULL);
+	
+	// Return elapsed seconds
+	return (end.tv_sec - start->tv_sec) + (end.tv_usec - start->tv_usec) / 1000000.0;
+}
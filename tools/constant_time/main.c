@@ -0,0 +1,589 @@
+// Header files
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <openssl/rand.h>
+#include "common.h"
+#include "crypto.h"
+#include "simulate.h"
+#include "storage.h"
+#include "transaction.h"
+
+
+// Definitions
+
+// Nanoseconds in a second
+#define NANOSECONDS_IN_A_SECOND 1000000000
+
+// Leakage threshold (the t-statistic above which a timing difference between the classes is considered to be detected)
+#define LEAKAGE_THRESHOLD 4.5
+
+// Warm up divisor (the fraction of measurements at the start of each test that are discarded)
+#define WARM_UP_DIVISOR 10
+
+// Scalar size
+#define SCALAR_SIZE 32
+
+
+// Constants
+
+// Cropping percentiles (measurements above a percentile are discarded to remove interruptions and other noise)
+static const double CROPPING_PERCENTILES[] = {1, 0.99, 0.9, 0.75, 0.5};
+
+
+// Structures
+
+// Constant time test
+struct ConstantTimeTest {
+
+	// Name
+	const char *name;
+	
+	// Number of measurements
+	size_t numberOfMeasurements;
+	
+	// Input size
+	size_t inputSize;
+	
+	// Create input
+	void (*createInput)(uint8_t *input, const bool isRandomClass);
+	
+	// Run
+	void (*run)(const uint8_t *input);
+};
+
+// Welch t-test
+struct WelchTTest {
+
+	// Number of measurements
+	double numberOfMeasurements[2];
+	
+	// Means
+	double means[2];
+	
+	// Sums of squared differences from the means
+	double sumsOfSquaredDifferences[2];
+};
+
+
+// Function prototypes
+
+// Create is zero array secure input
+static void createIsZeroArraySecureInput(uint8_t *input, const bool isRandomClass);
+
+// Run is zero array secure
+static void runIsZeroArraySecure(const uint8_t *input);
+
+// Create commit value input
+static void createCommitValueInput(uint8_t *input, const bool isRandomClass);
+
+// Run commit value
+static void runCommitValue(const uint8_t *input);
+
+// Create create single signer nonces input
+static void createCreateSingleSignerNoncesInput(uint8_t *input, const bool isRandomClass);
+
+// Run create single signer nonces
+static void runCreateSingleSignerNonces(const uint8_t *input);
+
+// Create decrypt data input
+static void createDecryptDataInput(uint8_t *input, const bool isRandomClass);
+
+// Run decrypt data
+static void runDecryptData(const uint8_t *input);
+
+// Create calculate bulletproof components input
+static void createCalculateBulletproofComponentsInput(uint8_t *input, const bool isRandomClass);
+
+// Run calculate bulletproof components
+static void runCalculateBulletproofComponents(const uint8_t *input);
+
+// Run constant time test
+static bool runConstantTimeTest(const struct ConstantTimeTest *test);
+
+// Update Welch t-test
+static void updateWelchTTest(struct WelchTTest *welchTTest, const bool isRandomClass, const double measurement);
+
+// Get Welch t-test statistic
+static double getWelchTTestStatistic(const struct WelchTTest *welchTTest);
+
+// Compare measurements
+static int compareMeasurements(const void *first, const void *second);
+
+// Get fixed scalar
+static void getFixedScalar(uint8_t *scalar, const uint8_t value);
+
+// Get random bytes
+static void getRandomBytes(uint8_t *bytes, const size_t length);
+
+// Get timestamp
+static uint64_t getTimestamp(void);
+
+
+// Global variables
+
+// Constant time tests
+static const struct ConstantTimeTest CONSTANT_TIME_TESTS[] = {
+
+	// Is zero array secure
+	{
+		.name = "isZeroArraySecure",
+		.numberOfMeasurements = 200000,
+		.inputSize = SCALAR_SIZE,
+		.createInput = createIsZeroArraySecureInput,
+		.run = runIsZeroArraySecure
+	},
+	
+	// Commit value
+	{
+		.name = "commitValue",
+		.numberOfMeasurements = 20000,
+		.inputSize = sizeof(uint64_t) + BLINDING_FACTOR_SIZE,
+		.createInput = createCommitValueInput,
+		.run = runCommitValue
+	},
+	
+	// Create single signer nonces
+	{
+		.name = "createSingleSignerNonces",
+		.numberOfMeasurements = 20000,
+		.inputSize = NONCE_SIZE,
+		.createInput = createCreateSingleSignerNoncesInput,
+		.run = runCreateSingleSignerNonces
+	},
+	
+	// Decrypt data
+	{
+		.name = "decryptData",
+		.numberOfMeasurements = 100000,
+		.inputSize = BLINDING_FACTOR_SIZE + ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE,
+		.createInput = createDecryptDataInput,
+		.run = runDecryptData
+	},
+	
+	// Calculate bulletproof components
+	{
+		.name = "calculateBulletproofComponents",
+		.numberOfMeasurements = 2000,
+		.inputSize = sizeof(uint64_t),
+		.createInput = createCalculateBulletproofComponentsInput,
+		.run = runCalculateBulletproofComponents
+	}
+};
+
+// Bulletproof blinding factor, commitment, rewind nonce, private nonce, and proof message
+static uint8_t bulletproofBlindingFactor[BLINDING_FACTOR_SIZE];
+static uint8_t bulletproofCommitment[UNCOMPRESSED_PUBLIC_KEY_SIZE];
+static uint8_t bulletproofRewindNonce[SCALAR_SIZE];
+static uint8_t bulletproofPrivateNonce[SCALAR_SIZE];
+static const uint8_t bulletproofProofMessage[PROOF_MESSAGE_SIZE];
+
+
+// Main function
+int main(void) {
+
+	// Create the bulletproof inputs that aren't secret classes
+	getFixedScalar(bulletproofBlindingFactor, 1);
+	getFixedScalar(bulletproofRewindNonce, 2);
+	getFixedScalar(bulletproofPrivateNonce, 3);
+	commitValue(bulletproofCommitment, 1, bulletproofBlindingFactor, false);
+	
+	// Go through all constant time tests
+	bool leakageDetected = false;
+	for(size_t i = 0; i < ARRAYLEN(CONSTANT_TIME_TESTS); ++i) {
+		
+		// Check if running the constant time test detected leakage or failed
+		if(!runConstantTimeTest(&CONSTANT_TIME_TESTS[i])) {
+			
+			// Set leakage detected
+			leakageDetected = true;
+		}
+	}
+	
+	// Restore random bytes
+	setRandomBytes(NULL, 0);
+	
+	// Return if no leakage was detected
+	return leakageDetected ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+
+// Supporting function implementation
+
+// Create is zero array secure input
+void createIsZeroArraySecureInput(uint8_t *input, const bool isRandomClass) {
+
+	// Check if random class
+	if(isRandomClass) {
+		
+		// Set value to random bytes
+		getRandomBytes(input, SCALAR_SIZE);
+	}
+	
+	// Otherwise
+	else {
+		
+		// Set value to zero
+		explicit_bzero(input, SCALAR_SIZE);
+	}
+}
+
+// Run is zero array secure
+void runIsZeroArraySecure(const uint8_t *input) {
+
+	// Check if value is zero
+	isZeroArraySecure(input, SCALAR_SIZE);
+}
+
+// Create commit value input
+void createCommitValueInput(uint8_t *input, const bool isRandomClass) {
+
+	// Check if random class
+	if(isRandomClass) {
+		
+		// Set value and blinding factor to random bytes
+		getRandomBytes(input, sizeof(uint64_t) + BLINDING_FACTOR_SIZE);
+	}
+	
+	// Otherwise
+	else {
+		
+		// Set value and blinding factor to one
+		const uint64_t value = 1;
+		memcpy(input, &value, sizeof(value));
+		getFixedScalar(&input[sizeof(value)], 1);
+	}
+}
+
+// Run commit value
+void runCommitValue(const uint8_t *input) {
+
+	// Get value from input
+	uint64_t value;
+	memcpy(&value, input, sizeof(value));
+	
+	// Commit value
+	uint8_t commitment[COMMITMENT_SIZE];
+	commitValue(commitment, value, &input[sizeof(value)], true);
+}
+
+// Create create single signer nonces input
+void createCreateSingleSignerNoncesInput(uint8_t *input, const bool isRandomClass) {
+
+	// Check if random class
+	if(isRandomClass) {
+		
+		// Set secret nonce to random bytes
+		getRandomBytes(input, NONCE_SIZE);
+	}
+	
+	// Otherwise
+	else {
+		
+		// Set secret nonce to one
+		getFixedScalar(input, 1);
+	}
+}
+
+// Run create single signer nonces
+void runCreateSingleSignerNonces(const uint8_t *input) {
+
+	// Set random bytes to the secret nonce
+	setRandomBytes(input, NONCE_SIZE);
+	
+	// Create single signer nonces
+	uint8_t secretNonce[NONCE_SIZE];
+	uint8_t publicNonce[COMPRESSED_PUBLIC_KEY_SIZE];
+	createSingleSignerNonces(secretNonce, publicNonce);
+}
+
+// Create decrypt data input
+void createDecryptDataInput(uint8_t *input, const bool isRandomClass) {
+
+	// Initialize secret nonce
+	uint8_t secretNonce[ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE - 1];
+	size_t secretNonceLength;
+	
+	// Set key to one for both classes since the simulated key schedule isn't the app's code
+	getFixedScalar(input, 1);
+	
+	// Check if random class
+	if(isRandomClass) {
+		
+		// Set secret nonce to random bytes
+		getRandomBytes(secretNonce, sizeof(secretNonce));
+		
+		// Set secret nonce length to a random length that has the same encrypted length to vary the padding
+		uint8_t random;
+		getRandomBytes(&random, sizeof(random));
+		secretNonceLength = sizeof(transaction.secretNonce) + random % (sizeof(secretNonce) - sizeof(transaction.secretNonce) + 1);
+	}
+	
+	// Otherwise
+	else {
+		
+		// Set secret nonce to two
+		getFixedScalar(secretNonce, 2);
+		
+		// Set secret nonce length
+		secretNonceLength = sizeof(transaction.secretNonce);
+	}
+	
+	// Encrypt the secret nonce with the key
+	encryptData(&input[BLINDING_FACTOR_SIZE], secretNonce, secretNonceLength, input, BLINDING_FACTOR_SIZE);
+}
+
+// Run decrypt data
+void runDecryptData(const uint8_t *input) {
+
+	// Decrypt the encrypted secret nonce with the key
+	uint8_t secretNonce[ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE];
+	decryptData(secretNonce, &input[BLINDING_FACTOR_SIZE], ENCRYPTED_TRANSACTION_SECRET_NONCE_SIZE, input, BLINDING_FACTOR_SIZE);
+}
+
+// Create calculate bulletproof components input
+void createCalculateBulletproofComponentsInput(uint8_t *input, const bool isRandomClass) {
+
+	// Check if random class
+	if(isRandomClass) {
+		
+		// Set value to random bytes
+		getRandomBytes(input, sizeof(uint64_t));
+	}
+	
+	// Otherwise
+	else {
+		
+		// Set value to zero
+		explicit_bzero(input, sizeof(uint64_t));
+	}
+}
+
+// Run calculate bulletproof components
+void runCalculateBulletproofComponents(const uint8_t *input) {
+
+	// Get value from input
+	uint64_t value;
+	memcpy(&value, input, sizeof(value));
+	
+	// Calculate bulletproof components
+	uint8_t tauX[SCALAR_SIZE];
+	uint8_t tOne[COMPRESSED_PUBLIC_KEY_SIZE];
+	uint8_t tTwo[COMPRESSED_PUBLIC_KEY_SIZE];
+	calculateBulletproofComponents(tauX, tOne, tTwo, value, bulletproofBlindingFactor, bulletproofCommitment, bulletproofRewindNonce, bulletproofPrivateNonce, bulletproofProofMessage);
+}
+
+// Run constant time test
+bool runConstantTimeTest(const struct ConstantTimeTest *test) {
+
+	// Display message
+	printf("Testing %s with %zu measurements\n", test->name, test->numberOfMeasurements);
+	
+	// Create classes, inputs, and measurements
+	bool *classes = malloc(test->numberOfMeasurements * sizeof(bool));
+	uint8_t *inputs = malloc(test->numberOfMeasurements * test->inputSize);
+	double *measurements = malloc(test->numberOfMeasurements * sizeof(double));
+	double *sortedMeasurements = malloc(test->numberOfMeasurements * sizeof(double));
+	if(!classes || !inputs || !measurements || !sortedMeasurements) {
+		
+		// Free memory
+		free(classes);
+		free(inputs);
+		free(measurements);
+		free(sortedMeasurements);
+		
+		// Display message
+		printf("Test failed: allocating memory failed\n");
+		
+		// Return false
+		return false;
+	}
+	
+	// Go through all measurements
+	for(size_t i = 0; i < test->numberOfMeasurements; ++i) {
+		
+		// Set measurement's class to a random class
+		uint8_t random;
+		getRandomBytes(&random, sizeof(random));
+		classes[i] = random & 1;
+		
+		// Create measurement's input for its class
+		(*test->createInput)(&inputs[i * test->inputSize], classes[i]);
+	}
+	
+	// Begin try
+	volatile bool failed = false;
+	volatile uint64_t totalNanoseconds = 0;
+	BEGIN_TRY {
+		
+		// Try
+		TRY {
+			
+			// Go through all measurements
+			for(size_t i = 0; i < test->numberOfMeasurements; ++i) {
+				
+				// Run test with the measurement's input and set the measurement to its duration
+				const uint64_t start = getTimestamp();
+				(*test->run)(&inputs[i * test->inputSize]);
+				const uint64_t duration = getTimestamp() - start;
+				measurements[i] = duration;
+				
+				// Update total nanoseconds
+				totalNanoseconds += duration;
+			}
+		}
+		
+		// Catch other errors
+		CATCH_OTHER(error) {
+			
+			// Display message
+			printf("Test failed: running %s threw error %04x\n", test->name, error);
+			
+			// Set failed
+			failed = true;
+		}
+		
+		// Finally
+		FINALLY {
+		}
+	}
+	
+	// End try
+	END_TRY;
+	
+	// Check if test didn't fail
+	double maximumTStatistic = 0;
+	size_t maximumTStatisticPercentileIndex = 0;
+	if(!failed) {
+		
+		// Display throughput
+		printf("Throughput: %f operations per second\n", test->numberOfMeasurements * (double)NANOSECONDS_IN_A_SECOND / totalNanoseconds);
+		
+		// Sort the measurements after the warm up
+		const size_t warmUpMeasurements = test->numberOfMeasurements / WARM_UP_DIVISOR;
+		const size_t numberOfSortedMeasurements = test->numberOfMeasurements - warmUpMeasurements;
+		memcpy(sortedMeasurements, &measurements[warmUpMeasurements], numberOfSortedMeasurements * sizeof(double));
+		qsort(sortedMeasurements, numberOfSortedMeasurements, sizeof(double), compareMeasurements);
+		
+		// Go through all cropping percentiles
+		for(size_t i = 0; i < ARRAYLEN(CROPPING_PERCENTILES); ++i) {
+			
+			// Get cropping threshold at the percentile
+			const double threshold = sortedMeasurements[(size_t)(CROPPING_PERCENTILES[i] * (numberOfSortedMeasurements - 1))];
+			
+			// Go through all measurements after the warm up
+			struct WelchTTest welchTTest = {0};
+			for(size_t j = warmUpMeasurements; j < test->numberOfMeasurements; ++j) {
+				
+				// Check if measurement isn't cropped
+				if(measurements[j] <= threshold) {
+					
+					// Update Welch t-test with the measurement
+					updateWelchTTest(&welchTTest, classes[j], measurements[j]);
+				}
+			}
+			
+			// Check if the Welch t-test's statistic is the largest
+			const double tStatistic = fabs(getWelchTTestStatistic(&welchTTest));
+			if(tStatistic > maximumTStatistic) {
+				
+				// Set maximum t-statistic
+				maximumTStatistic = tStatistic;
+				maximumTStatisticPercentileIndex = i;
+			}
+		}
+		
+		// Display maximum t-statistic
+		printf("Maximum t-statistic: %f (measurements up to the %g percentile)\n", maximumTStatistic, CROPPING_PERCENTILES[maximumTStatisticPercentileIndex] * 100);
+		
+		// Display result
+		printf((maximumTStatistic > LEAKAGE_THRESHOLD) ? "Possible leakage detected\n" : "No leakage detected\n");
+	}
+	
+	// Free memory
+	free(classes);
+	free(inputs);
+	free(measurements);
+	free(sortedMeasurements);
+	
+	// Return if test didn't fail and no leakage was detected
+	return !failed && maximumTStatistic <= LEAKAGE_THRESHOLD;
+}
+
+// Update Welch t-test
+void updateWelchTTest(struct WelchTTest *welchTTest, const bool isRandomClass, const double measurement) {
+
+	// Update the class's number of measurements, mean, and sum of squared differences from the mean
+	++welchTTest->numberOfMeasurements[isRandomClass];
+	const double difference = measurement - welchTTest->means[isRandomClass];
+	welchTTest->means[isRandomClass] += difference / welchTTest->numberOfMeasurements[isRandomClass];
+	welchTTest->sumsOfSquaredDifferences[isRandomClass] += difference * (measurement - welchTTest->means[isRandomClass]);
+}
+
+// Get Welch t-test statistic
+double getWelchTTestStatistic(const struct WelchTTest *welchTTest) {
+
+	// Check if a class doesn't have enough measurements
+	if(welchTTest->numberOfMeasurements[false] < 2 || welchTTest->numberOfMeasurements[true] < 2) {
+		
+		// Return zero
+		return 0;
+	}
+	
+	// Get the classes' variances
+	const double fixedVariance = welchTTest->sumsOfSquaredDifferences[false] / (welchTTest->numberOfMeasurements[false] - 1);
+	const double randomVariance = welchTTest->sumsOfSquaredDifferences[true] / (welchTTest->numberOfMeasurements[true] - 1);
+	
+	// Check if the classes don't have variance
+	const double standardError = sqrt(fixedVariance / welchTTest->numberOfMeasurements[false] + randomVariance / welchTTest->numberOfMeasurements[true]);
+	if(!standardError) {
+		
+		// Return zero
+		return 0;
+	}
+	
+	// Return t-statistic
+	return (welchTTest->means[false] - welchTTest->means[true]) / standardError;
+}
+
+// Compare measurements
+int compareMeasurements(const void *first, const void *second) {
+
+	// Return comparison of the measurements
+	return (*(const double *)first > *(const double *)second) - (*(const double *)first < *(const double *)second);
+}
+
+// Get fixed scalar
+void getFixedScalar(uint8_t *scalar, const uint8_t value) {
+
+	// Set scalar to the value
+	explicit_bzero(scalar, SCALAR_SIZE);
+	scalar[SCALAR_SIZE - 1] = value;
+}
+
+// Get random bytes
+void getRandomBytes(uint8_t *bytes, const size_t length) {
+
+	// Check if getting random bytes failed
+	if(RAND_bytes(bytes, length) != 1) {
+		
+		// Display message
+		printf("Getting random bytes failed\n");
+		
+		// Exit
+		exit(EXIT_FAILURE);
+	}
+}
+
+// Get timestamp
+uint64_t getTimestamp(void) {
+
+	// Get current time
+	struct timespec currentTime;
+	clock_gettime(CLOCK_MONOTONIC, &currentTime);
+	
+	// Return current time in nanoseconds
+	return currentTime.tv_sec * (uint64_t)NANOSECONDS_IN_A_SECOND + currentTime.tv_nsec;
+}
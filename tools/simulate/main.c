@@ -3,6 +3,7 @@
 #include "common.h"
 #include "crypto.h"
 #include "mqs.h"
+#include "simulate.h"
 #include "storage.h"
 
 
@@ -74,13 +75,13 @@ int main(void) {
 			printf("Testing pic and nvm_write\n");
 			
 			// Set storage to invalid value
-			storage.currentTransactionSecretNonceIndex = NUMBER_OF_TRANSACTION_SECRET_NONCES;
+			storage.transactionSecretNonceRecords[0].sequenceNumber = NUMBER_OF_TRANSACTION_SECRET_NONCES;
 			
 			// Initialize storage to reset it
 			initializeStorage();
 			
 			// Check if test was successful
-			if(!storage.currentTransactionSecretNonceIndex) {
+			if(!storage.transactionSecretNonceRecords[0].sequenceNumber && !getCurrentTransactionSecretNonceSequenceNumber()) {
 			
 				// Display message
 				printf("Test succeeded\n");
@@ -720,6 +721,68 @@ int main(void) {
 				return 1;
 			}
 		}
+		
+		{
+		
+			// Display message
+			printf("Testing os_perso_derive_node_with_seed_key with a seed\n");
+			
+			// Check if setting seed to the functional tests' mnemonic failed
+			if(!setSeedFromString("abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about")) {
+			
+				// Display message
+				printf("Test failed\n");
+				
+				// Return failure
+				return 1;
+			}
+			
+			// Get private keys and chain codes for the first and second accounts with memoisation disabled and enabled
+			uint8_t privateKeys[4][64];
+			uint8_t chainCodes[4][32];
+			for(size_t i = 0; i < ARRAYLEN(privateKeys); ++i) {
+			
+				// Set derivation memoisation
+				setDerivationMemoisation(i >= 2);
+				
+				// Get private key and chain code for the account
+				CX_THROW(os_derive_bip32_with_seed_no_throw(HDW_NORMAL, CX_CURVE_SECP256K1, (uint32_t[]){44 | HARDENED_PATH_MASK, 593 | HARDENED_PATH_MASK, (i % 2) | HARDENED_PATH_MASK, 0, 0}, 5, privateKeys[i], chainCodes[i], (uint8_t *)"IamVoldemort", sizeof("IamVoldemort") - sizeof((char)'\0')));
+				
+				// Check if deriving the account again when memoised doesn't give the same result
+				uint8_t privateKey[64];
+				uint8_t chainCode[32];
+				CX_THROW(os_derive_bip32_with_seed_no_throw(HDW_NORMAL, CX_CURVE_SECP256K1, (uint32_t[]){44 | HARDENED_PATH_MASK, 593 | HARDENED_PATH_MASK, (i % 2) | HARDENED_PATH_MASK, 0, 0}, 5, privateKey, chainCode, (uint8_t *)"IamVoldemort", sizeof("IamVoldemort") - sizeof((char)'\0')));
+				if(i >= 2 && (memcmp(privateKey, privateKeys[i], 32) || memcmp(chainCode, chainCodes[i], sizeof(chainCode)))) {
+				
+					// Display message
+					printf("Test failed\n");
+					
+					// Return failure
+					return 1;
+				}
+			}
+			
+			// Restore seed and disable derivation memoisation
+			setSeed(NULL, 0);
+			setDerivationMemoisation(false);
+			
+			// Check if test was successful
+			if(!memcmp(privateKeys[0], (uint8_t[]){0x50, 0x75, 0x8B, 0x15, 0x3D, 0xE0, 0xA7, 0x2E, 0xDC, 0x0F, 0x0E, 0xE0, 0x4E, 0xC9, 0x7B, 0x84, 0xAF, 0xBD, 0x87, 0x06, 0x84, 0xB5, 0xCF, 0x58, 0x8B, 0xD0, 0xE6, 0x29, 0x56, 0x8D, 0x0D, 0xDA}, 32) && !memcmp(chainCodes[0], (uint8_t[]){0xC0, 0x49, 0x72, 0xDC, 0x22, 0xCB, 0xF4, 0x2F, 0x7E, 0x5D, 0x71, 0x8E, 0x43, 0xC7, 0x12, 0xF9, 0x54, 0x12, 0xCB, 0xA3, 0x0C, 0x38, 0xDE, 0xBB, 0x18, 0xF9, 0x85, 0x34, 0x74, 0x99, 0xA9, 0xB7}, sizeof(chainCodes[0])) && !memcmp(privateKeys[1], (uint8_t[]){0x13, 0xBB, 0x3E, 0x47, 0x7B, 0xCD, 0xF6, 0x9A, 0x01, 0xB0, 0x9E, 0x95, 0x2F, 0x9A, 0x39, 0x3E, 0x86, 0xFB, 0x3F, 0x8A, 0x03, 0x0E, 0xA0, 0xFF, 0x76, 0xDB, 0xC4, 0x9A, 0xA8, 0x85, 0xE2, 0x5D}, 32) && !memcmp(chainCodes[1], (uint8_t[]){0x00, 0xEF, 0x06, 0xDC, 0x54, 0x0E, 0x4D, 0x5D, 0xCA, 0x39, 0x5C, 0xA0, 0xCC, 0x62, 0xC6, 0xD5, 0x6B, 0x5F, 0x11, 0x37, 0x79, 0x73, 0x40, 0xEF, 0xA9, 0xC1, 0xD8, 0x8C, 0xFE, 0xFE, 0x08, 0xBC}, sizeof(chainCodes[1])) && !memcmp(privateKeys[2], privateKeys[0], 32) && !memcmp(chainCodes[2], chainCodes[0], sizeof(chainCodes[2])) && !memcmp(privateKeys[3], privateKeys[1], 32) && !memcmp(chainCodes[3], chainCodes[1], sizeof(chainCodes[3]))) {
+			
+				// Display message
+				printf("Test succeeded\n");
+			}
+			
+			// Otherwise
+			else {
+			
+				// Display message
+				printf("Test failed\n");
+				
+				// Return failure
+				return 1;
+			}
+		}
 	#endif
 	
 	{
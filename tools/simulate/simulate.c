@@ -1,6 +1,8 @@
 // This file is used by the unit tests and fuzzers to provide replacement functions for those accessed by syscalls to the hardware wallet's operating system
 
 // Header files
+#include <stdio.h>
+#include <stdlib.h>
 #include <sys/time.h>
 #include <openssl/ec.h>
 #include <openssl/evp.h>
@@ -8,6 +10,7 @@
 #include <openssl/hmac.h>
 #include "common.h"
 #include "crypto.h"
+#include "simulate.h"
 
 // Check if using OpenSSL 3 or newer
 #if OPENSSL_VERSION_MAJOR >= 3
@@ -17,24 +20,163 @@
 #endif
 
 
+// Definitions
+
+// Uncompressed public key prefix
+#define UNCOMPRESSED_PUBLIC_KEY_PREFIX 0x04
+
+// Seed environment variable
+#define SEED_ENVIRONMENT_VARIABLE "SIMULATE_SEED"
+
+// Seed file environment variable
+#define SEED_FILE_ENVIRONMENT_VARIABLE "SIMULATE_SEED_FILE"
+
+// Derivation memoisation environment variable
+#define DERIVATION_MEMOISATION_ENVIRONMENT_VARIABLE "SIMULATE_MEMOISE_DERIVATIONS"
+
+// Hexadecimal seed prefix
+#define HEXADECIMAL_SEED_PREFIX "hex:"
+
+// BIP39 salt
+#define BIP39_SALT "mnemonic"
+
+// BIP39 number of iterations
+#define BIP39_NUMBER_OF_ITERATIONS 2048
+
+// Maximum seed string size
+#define MAXIMUM_SEED_STRING_SIZE 1024
+
+// Number of memoised derivations
+#define NUMBER_OF_MEMOISED_DERIVATIONS 16
+
+// Maximum memoised path length
+#define MAXIMUM_MEMOISED_PATH_LENGTH 10
+
+// Maximum memoised seed key size
+#define MAXIMUM_MEMOISED_SEED_KEY_SIZE 32
+
+
+// Constants
+
+// Default BIP32 seed key
+static const char DEFAULT_BIP32_SEED_KEY[] = "Bitcoin seed";
+
+// secp256k1 curve order
+static const uint8_t SECP256K1_CURVE_ORDER[] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xBA, 0xAE, 0xDC, 0xE6, 0xAF, 0x48, 0xA0, 0x3B, 0xBF, 0xD2, 0x5E, 0x8C, 0xD0, 0x36, 0x41, 0x41};
+
+// secp256k1 generator
+static const uint8_t SECP256K1_GENERATOR[] = {UNCOMPRESSED_PUBLIC_KEY_PREFIX, 0x79, 0xBE, 0x66, 0x7E, 0xF9, 0xDC, 0xBB, 0xAC, 0x55, 0xA0, 0x62, 0x95, 0xCE, 0x87, 0x0B, 0x07, 0x02, 0x9B, 0xFC, 0xDB, 0x2D, 0xCE, 0x28, 0xD9, 0x59, 0xF2, 0x81, 0x5B, 0x16, 0xF8, 0x17, 0x98, 0x48, 0x3A, 0xDA, 0x77, 0x26, 0xA3, 0xC4, 0x65, 0x5D, 0xA4, 0xFB, 0xFC, 0x0E, 0x11, 0x08, 0xA8, 0xFD, 0x17, 0xB4, 0x48, 0xA6, 0x85, 0x54, 0x19, 0x9C, 0x47, 0xD0, 0x8F, 0xFB, 0x10, 0xD4, 0xB8};
+
+
+// Structures
+
+// Memoised derivation
+struct MemoisedDerivation {
+
+	// Path
+	unsigned int path[MAXIMUM_MEMOISED_PATH_LENGTH];
+	
+	// Path length
+	size_t pathLength;
+	
+	// Seed key
+	uint8_t seedKey[MAXIMUM_MEMOISED_SEED_KEY_SIZE];
+	
+	// Seed key length
+	size_t seedKeyLength;
+	
+	// Private key
+	uint8_t privateKey[sizeof(SECP256K1_CURVE_ORDER)];
+	
+	// Chain code
+	uint8_t chainCode[CHAIN_CODE_SIZE];
+	
+	// Used
+	bool used;
+};
+
+
 // Global variables
 
-// IO APDU buffer
-unsigned char G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// IO APDU buffer
+	static SESSION_LOCAL unsigned char ioApduBuffer[IO_APDU_BUFFER_SIZE];
+
+// Otherwise
+#else
+
+	// IO APDU buffer
+	unsigned char G_io_apdu_buffer[IO_APDU_BUFFER_SIZE];
+#endif
 
 // Try context
-static try_context_t *tryContext = NULL;
+static SESSION_LOCAL try_context_t *tryContext = NULL;
 
 // Digest context
-static EVP_MD_CTX *digestContext = NULL;
+static SESSION_LOCAL EVP_MD_CTX *digestContext = NULL;
 
 //  EC points
-static EC_POINT *ecPointOne = NULL;
-static EC_POINT *ecPointTwo = NULL;
+static SESSION_LOCAL EC_POINT *ecPointOne = NULL;
+static SESSION_LOCAL EC_POINT *ecPointTwo = NULL;
+
+// Seed
+static SESSION_LOCAL uint8_t seed[MAXIMUM_SEED_SIZE];
+
+// Seed length
+static SESSION_LOCAL size_t seedLength = 0;
+
+// Seed loaded
+static SESSION_LOCAL bool seedLoaded = false;
+
+// Derivation memoisation enabled
+static SESSION_LOCAL bool derivationMemoisationEnabled = false;
+
+// Memoised derivations
+static SESSION_LOCAL struct MemoisedDerivation memoisedDerivations[NUMBER_OF_MEMOISED_DERIVATIONS];
+
+// Next memoised derivation index
+static SESSION_LOCAL size_t nextMemoisedDerivationIndex = 0;
+
+// Random bytes
+static SESSION_LOCAL uint8_t randomBytes[MAXIMUM_RANDOM_BYTES_SIZE];
+
+// Random bytes length
+static SESSION_LOCAL size_t randomBytesLength = 0;
+
+
+// Function prototypes
+
+// Load seed from environment
+static void loadSeedFromEnvironment(void);
+
+// Get memoised derivation
+static struct MemoisedDerivation *getMemoisedDerivation(const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength);
+
+// Memoise derivation
+static void memoiseDerivation(const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength, const uint8_t *privateKey, const uint8_t *chainCode);
+
+// Clear memoised derivations
+static void clearMemoisedDerivations(void);
+
+// Derive BIP32 node
+static bool deriveBip32Node(uint8_t *privateKey, uint8_t *chainCode, const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength);
 
 
 // Supporting function implementation
 
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Get session IO APDU buffer
+	unsigned char (*getSessionIoApduBuffer(void))[IO_APDU_BUFFER_SIZE] {
+	
+		// Return session's IO APDU buffer
+		return &ioApduBuffer;
+	}
+#endif
+
 // PIC
 void *pic(void *linked_address) {
 
@@ -1722,8 +1864,8 @@ cx_err_t cx_aes_init_key_no_throw(const uint8_t *rawkey, size_t key_len, cx_aes_
 	return CX_OK;
 }
 
-// CX AES no throw
-cx_err_t cx_aes_no_throw(const cx_aes_key_t *key, uint32_t mode, const uint8_t *in, size_t in_len, uint8_t *out, size_t *out_len) {
+// CX AES IV no throw
+cx_err_t cx_aes_iv_no_throw(const cx_aes_key_t *key, uint32_t mode, const uint8_t *iv, size_t iv_len, const uint8_t *in, size_t in_len, uint8_t *out, size_t *out_len) {
 
 	// Check if creating context failed
 	EVP_CIPHER_CTX *context = EVP_CIPHER_CTX_new();
@@ -1734,7 +1876,7 @@ cx_err_t cx_aes_no_throw(const cx_aes_key_t *key, uint32_t mode, const uint8_t *
 	}
 	
 	// Check if initializing context failed
-	if(!EVP_CipherInit(context, EVP_aes_256_cbc(), key->keys, NULL, (mode & CX_ENCRYPT) ? 1 : 0)) {
+	if(!EVP_CipherInit(context, EVP_aes_256_cbc(), key->keys, iv, (mode & CX_ENCRYPT) ? 1 : 0)) {
 	
 		// Free context
 		EVP_CIPHER_CTX_free(context);
@@ -1767,6 +1909,13 @@ cx_err_t cx_aes_no_throw(const cx_aes_key_t *key, uint32_t mode, const uint8_t *
 	return CX_OK;
 }
 
+// CX AES no throw
+cx_err_t cx_aes_no_throw(const cx_aes_key_t *key, uint32_t mode, const uint8_t *in, size_t in_len, uint8_t *out, size_t *out_len) {
+
+	// Return encrypting or decrypting the in with a zero IV
+	return cx_aes_iv_no_throw(key, mode, NULL, 0, in, in_len, out, out_len);
+}
+
 // CX HMAC SHA-512
 size_t cx_hmac_sha512(const uint8_t *key, size_t key_len, const uint8_t *in, size_t len, uint8_t *mac, size_t mac_len) {
 
@@ -1891,14 +2040,78 @@ void cx_rng_no_throw(uint8_t *buffer, size_t len) {
 	// Go through all bytes in the buffer
 	for(size_t i = 0; i < len; ++i) {
 	
-		// Set byte to value
-		buffer[i] = i;
+		// Set byte to the random bytes' byte if random bytes were set or to the value otherwise
+		buffer[i] = randomBytesLength ? randomBytes[i % randomBytesLength] : i;
 	}
 }
 
 // OS perso derive node with seed key
 void os_perso_derive_node_with_seed_key(unsigned int mode, cx_curve_t curve, const unsigned int *path PLENGTH(4 * (pathLength & 0x0FFFFFFFu)), unsigned int pathLength, unsigned char *privateKey PLENGTH(64), unsigned char *chain PLENGTH(32), unsigned char *seed_key PLENGTH(seed_key_length), unsigned int seed_key_length) {
 
+	// Check if seed wasn't loaded
+	if(!seedLoaded) {
+	
+		// Load seed from environment
+		loadSeedFromEnvironment();
+	}
+	
+	// Check if a seed was set
+	if(seedLength) {
+	
+		// Check if curve isn't secp256k1
+		if(curve != CX_CURVE_SECP256K1) {
+		
+			// Throw internal error error
+			THROW(INTERNAL_ERROR_ERROR);
+		}
+		
+		// Initialize chain code
+		uint8_t chainCode[CHAIN_CODE_SIZE];
+		
+		// Clear private key
+		explicit_bzero(privateKey, 64);
+		
+		// Check if derivation is memoised
+		const struct MemoisedDerivation *memoisedDerivation = getMemoisedDerivation(path, pathLength & 0x0FFFFFFF, seed_key, seed_key_length);
+		if(memoisedDerivation) {
+		
+			// Set private key and chain code to the memoised derivation's
+			memcpy(privateKey, memoisedDerivation->privateKey, sizeof(memoisedDerivation->privateKey));
+			memcpy(chainCode, memoisedDerivation->chainCode, sizeof(memoisedDerivation->chainCode));
+		}
+		
+		// Otherwise check if deriving node from the seed failed
+		else if(!deriveBip32Node(privateKey, chainCode, path, pathLength & 0x0FFFFFFF, seed_key, seed_key_length)) {
+		
+			// Clear private key and chain code
+			explicit_bzero(privateKey, 64);
+			explicit_bzero(chainCode, sizeof(chainCode));
+			
+			// Throw internal error error
+			THROW(INTERNAL_ERROR_ERROR);
+		}
+		
+		// Otherwise
+		else {
+		
+			// Memoise derivation
+			memoiseDerivation(path, pathLength & 0x0FFFFFFF, seed_key, seed_key_length, privateKey, chainCode);
+		}
+		
+		// Check if getting chain code
+		if(chain) {
+		
+			// Set chain code
+			memcpy(chain, chainCode, sizeof(chainCode));
+		}
+		
+		// Clear chain code
+		explicit_bzero(chainCode, sizeof(chainCode));
+		
+		// Return
+		return;
+	}
+
 	// Set private key
 	memcpy(privateKey, (unsigned char[]){0x50, 0x75, 0x8B, 0x15, 0x3D, 0xE0, 0xA7, 0x2E, 0xDC, 0x0F, 0x0E, 0xE0, 0x4E, 0xC9, 0x7B, 0x84, 0xAF, 0xBD, 0x87, 0x06, 0x84, 0xB5, 0xCF, 0x58, 0x8B, 0xD0, 0xE6, 0x29, 0x56, 0x8D, 0x0D, 0xDA, 0x81, 0x83, 0x00, 0x60, 0x10, 0x13, 0x00, 0x20, 0x4A, 0x03, 0x00, 0x20, 0x58, 0x03, 0x00, 0x20, 0x50, 0x03, 0x00, 0x20, 0x4C, 0x03, 0x00, 0x20, 0x01, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x20}, 64);
 	
@@ -1916,3 +2129,372 @@ char os_secure_memcmp(void *src1, void *src2, unsigned int length) {
 	// Return comparing sources
 	return memcmp(src1, src2, length);
 }
+
+// Set seed
+bool setSeed(const uint8_t *newSeed, const size_t newSeedLength) {
+
+	// Check if new seed is too big
+	if(newSeedLength > sizeof(seed)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Clear memoised derivations
+	clearMemoisedDerivations();
+	
+	// Clear seed
+	explicit_bzero(seed, sizeof(seed));
+	
+	// Check if new seed exists
+	if(newSeedLength) {
+	
+		// Set seed
+		memcpy(seed, newSeed, newSeedLength);
+	}
+	
+	// Set seed length
+	seedLength = newSeedLength;
+	
+	// Set that seed was loaded
+	seedLoaded = true;
+	
+	// Return true
+	return true;
+}
+
+// Set seed from string
+bool setSeedFromString(const char *string) {
+
+	// Check if string is a hexadecimal seed
+	if(!strncmp(string, HEXADECIMAL_SEED_PREFIX, sizeof(HEXADECIMAL_SEED_PREFIX) - sizeof((char)'\0'))) {
+	
+		// Get hexadecimal seed
+		const char *hexadecimalSeed = &string[sizeof(HEXADECIMAL_SEED_PREFIX) - sizeof((char)'\0')];
+		const size_t hexadecimalSeedLength = strlen(hexadecimalSeed);
+		
+		// Check if hexadecimal seed's length is invalid
+		if(!hexadecimalSeedLength || hexadecimalSeedLength % HEXADECIMAL_CHARACTER_SIZE || hexadecimalSeedLength / HEXADECIMAL_CHARACTER_SIZE > MAXIMUM_SEED_SIZE) {
+		
+			// Return false
+			return false;
+		}
+		
+		// Go through all bytes in the seed
+		uint8_t newSeed[MAXIMUM_SEED_SIZE];
+		for(size_t i = 0; i < hexadecimalSeedLength / HEXADECIMAL_CHARACTER_SIZE; ++i) {
+		
+			// Check if getting byte from the hexadecimal seed failed
+			char byte[HEXADECIMAL_CHARACTER_SIZE + sizeof((char)'\0')] = {hexadecimalSeed[i * HEXADECIMAL_CHARACTER_SIZE], hexadecimalSeed[i * HEXADECIMAL_CHARACTER_SIZE + 1]};
+			char *end;
+			newSeed[i] = strtoul(byte, &end, 16);
+			if(*end) {
+			
+				// Clear new seed
+				explicit_bzero(newSeed, sizeof(newSeed));
+				
+				// Return false
+				return false;
+			}
+		}
+		
+		// Set seed
+		const bool result = setSeed(newSeed, hexadecimalSeedLength / HEXADECIMAL_CHARACTER_SIZE);
+		
+		// Clear new seed
+		explicit_bzero(newSeed, sizeof(newSeed));
+		
+		// Return result
+		return result;
+	}
+	
+	// Check if getting seed from the mnemonic failed
+	uint8_t newSeed[MAXIMUM_SEED_SIZE];
+	if(cx_pbkdf2_no_throw(CX_SHA512, (const uint8_t *)string, strlen(string), (uint8_t *)BIP39_SALT, sizeof(BIP39_SALT) - sizeof((char)'\0'), BIP39_NUMBER_OF_ITERATIONS, newSeed, sizeof(newSeed)) != CX_OK) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set seed
+	const bool result = setSeed(newSeed, sizeof(newSeed));
+	
+	// Clear new seed
+	explicit_bzero(newSeed, sizeof(newSeed));
+	
+	// Return result
+	return result;
+}
+
+// Set derivation memoisation
+void setDerivationMemoisation(const bool enable) {
+
+	// Clear memoised derivations
+	clearMemoisedDerivations();
+	
+	// Set derivation memoisation enabled
+	derivationMemoisationEnabled = enable;
+}
+
+// Set random bytes
+bool setRandomBytes(const uint8_t *newRandomBytes, const size_t newRandomBytesLength) {
+
+	// Check if new random bytes are too big
+	if(newRandomBytesLength > sizeof(randomBytes)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Clear random bytes
+	explicit_bzero(randomBytes, sizeof(randomBytes));
+	
+	// Check if new random bytes exist
+	if(newRandomBytesLength) {
+	
+		// Set random bytes
+		memcpy(randomBytes, newRandomBytes, newRandomBytesLength);
+	}
+	
+	// Set random bytes length
+	randomBytesLength = newRandomBytesLength;
+	
+	// Return true
+	return true;
+}
+
+// Load seed from environment
+void loadSeedFromEnvironment(void) {
+
+	// Set that seed was loaded
+	seedLoaded = true;
+	
+	// Check if derivation memoisation is requested
+	if(getenv(DERIVATION_MEMOISATION_ENVIRONMENT_VARIABLE)) {
+	
+		// Enable derivation memoisation
+		derivationMemoisationEnabled = true;
+	}
+	
+	// Get seed and seed file from the environment
+	const char *seedString = getenv(SEED_ENVIRONMENT_VARIABLE);
+	const char *seedFile = getenv(SEED_FILE_ENVIRONMENT_VARIABLE);
+	
+	// Check if seed is provided
+	if(seedString) {
+	
+		// Check if setting seed failed
+		if(!setSeedFromString(seedString)) {
+		
+			// Throw internal error error
+			THROW(INTERNAL_ERROR_ERROR);
+		}
+	}
+	
+	// Otherwise check if seed file is provided
+	else if(seedFile) {
+	
+		// Check if opening the seed file failed
+		FILE *file = fopen(seedFile, "r");
+		if(!file) {
+		
+			// Throw internal error error
+			THROW(INTERNAL_ERROR_ERROR);
+		}
+		
+		// Read seed string from the file
+		char fileSeedString[MAXIMUM_SEED_STRING_SIZE];
+		const size_t fileSeedStringLength = fread(fileSeedString, sizeof(fileSeedString[0]), sizeof(fileSeedString) - sizeof((char)'\0'), file);
+		fclose(file);
+		fileSeedString[fileSeedStringLength] = '\0';
+		
+		// Remove line ending from the seed string
+		fileSeedString[strcspn(fileSeedString, "\r\n")] = '\0';
+		
+		// Set seed
+		const bool result = setSeedFromString(fileSeedString);
+		
+		// Clear seed string
+		explicit_bzero(fileSeedString, sizeof(fileSeedString));
+		
+		// Check if setting seed failed
+		if(!result) {
+		
+			// Throw internal error error
+			THROW(INTERNAL_ERROR_ERROR);
+		}
+	}
+}
+
+// Get memoised derivation
+struct MemoisedDerivation *getMemoisedDerivation(const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength) {
+
+	// Check if derivation memoisation isn't enabled
+	if(!derivationMemoisationEnabled) {
+	
+		// Return nothing
+		return NULL;
+	}
+	
+	// Go through all memoised derivations
+	for(size_t i = 0; i < ARRAYLEN(memoisedDerivations); ++i) {
+	
+		// Check if memoised derivation is for the path and seed key
+		struct MemoisedDerivation *memoisedDerivation = &memoisedDerivations[i];
+		if(memoisedDerivation->used && memoisedDerivation->pathLength == pathLength && !memcmp(memoisedDerivation->path, path, pathLength * sizeof(path[0])) && memoisedDerivation->seedKeyLength == ((seedKey) ? seedKeyLength : 0) && (!memoisedDerivation->seedKeyLength || !memcmp(memoisedDerivation->seedKey, seedKey, seedKeyLength))) {
+		
+			// Return memoised derivation
+			return memoisedDerivation;
+		}
+	}
+	
+	// Return nothing
+	return NULL;
+}
+
+// Memoise derivation
+void memoiseDerivation(const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength, const uint8_t *privateKey, const uint8_t *chainCode) {
+
+	// Check if derivation memoisation isn't enabled or the derivation can't be memoised
+	if(!derivationMemoisationEnabled || pathLength > MAXIMUM_MEMOISED_PATH_LENGTH || (seedKey && seedKeyLength > MAXIMUM_MEMOISED_SEED_KEY_SIZE)) {
+	
+		// Return
+		return;
+	}
+	
+	// Replace the oldest memoised derivation
+	struct MemoisedDerivation *memoisedDerivation = &memoisedDerivations[nextMemoisedDerivationIndex];
+	nextMemoisedDerivationIndex = (nextMemoisedDerivationIndex + 1) % ARRAYLEN(memoisedDerivations);
+	
+	// Set memoised derivation's path, private key, and chain code
+	memcpy(memoisedDerivation->path, path, pathLength * sizeof(path[0]));
+	memoisedDerivation->pathLength = pathLength;
+	memcpy(memoisedDerivation->privateKey, privateKey, sizeof(memoisedDerivation->privateKey));
+	memcpy(memoisedDerivation->chainCode, chainCode, sizeof(memoisedDerivation->chainCode));
+	memoisedDerivation->used = true;
+	
+	// Check if seed key exists
+	memoisedDerivation->seedKeyLength = (seedKey) ? seedKeyLength : 0;
+	if(memoisedDerivation->seedKeyLength) {
+	
+		// Set memoised derivation's seed key
+		memcpy(memoisedDerivation->seedKey, seedKey, memoisedDerivation->seedKeyLength);
+	}
+}
+
+// Clear memoised derivations
+void clearMemoisedDerivations(void) {
+
+	// Clear memoised derivations
+	explicit_bzero(memoisedDerivations, sizeof(memoisedDerivations));
+	nextMemoisedDerivationIndex = 0;
+}
+
+// Derive BIP32 node
+bool deriveBip32Node(uint8_t *privateKey, uint8_t *chainCode, const unsigned int *path, const size_t pathLength, const uint8_t *seedKey, const size_t seedKeyLength) {
+
+	// Get master node from the seed using the seed key or the default seed key
+	uint8_t node[CX_SHA512_SIZE];
+	if(cx_hmac_sha512((seedKey && seedKeyLength) ? seedKey : (const uint8_t *)DEFAULT_BIP32_SEED_KEY, (seedKey && seedKeyLength) ? seedKeyLength : sizeof(DEFAULT_BIP32_SEED_KEY) - sizeof((char)'\0'), seed, seedLength, node, sizeof(node)) != sizeof(node)) {
+	
+		// Return false
+		return false;
+	}
+	
+	// Set private key and chain code to the master node's
+	memcpy(privateKey, node, sizeof(SECP256K1_CURVE_ORDER));
+	memcpy(chainCode, &node[sizeof(SECP256K1_CURVE_ORDER)], CHAIN_CODE_SIZE);
+	
+	// Go through all indices in the path
+	for(size_t i = 0; i < pathLength; ++i) {
+	
+		// Check if index is hardened
+		uint8_t data[COMPRESSED_PUBLIC_KEY_SIZE + sizeof(uint32_t)];
+		if(path[i] & HARDENED_PATH_MASK) {
+		
+			// Set data's key to the private key
+			data[0] = 0;
+			memcpy(&data[sizeof(data[0])], privateKey, sizeof(SECP256K1_CURVE_ORDER));
+		}
+		
+		// Otherwise
+		else {
+		
+			// Check if getting the private key's public key failed
+			uint8_t publicKey[sizeof(SECP256K1_GENERATOR)];
+			memcpy(publicKey, SECP256K1_GENERATOR, sizeof(SECP256K1_GENERATOR));
+			if(cx_ecfp_scalar_mult_no_throw(CX_CURVE_SECP256K1, publicKey, privateKey, sizeof(SECP256K1_CURVE_ORDER)) != CX_OK) {
+			
+				// Clear node and data
+				explicit_bzero(node, sizeof(node));
+				explicit_bzero(data, sizeof(data));
+				
+				// Return false
+				return false;
+			}
+			
+			// Set data's key to the compressed public key
+			data[0] = (publicKey[sizeof(publicKey) - 1] & 1) ? ODD_COMPRESSED_PUBLIC_KEY_PREFIX : EVEN_COMPRESSED_PUBLIC_KEY_PREFIX;
+			memcpy(&data[PUBLIC_KEY_PREFIX_SIZE], &publicKey[PUBLIC_KEY_PREFIX_SIZE], PUBLIC_KEY_COMPONENT_SIZE);
+		}
+		
+		// Set data's index
+		U4BE_ENCODE(data, COMPRESSED_PUBLIC_KEY_SIZE, path[i]);
+		
+		// Check if getting child node failed
+		if(cx_hmac_sha512(chainCode, CHAIN_CODE_SIZE, data, sizeof(data), node, sizeof(node)) != sizeof(node)) {
+		
+			// Clear node and data
+			explicit_bzero(node, sizeof(node));
+			explicit_bzero(data, sizeof(data));
+			
+			// Return false
+			return false;
+		}
+		
+		// Clear data
+		explicit_bzero(data, sizeof(data));
+		
+		// Check if child node's tweak isn't less than the curve order
+		int comparison;
+		cx_math_cmp_no_throw(node, SECP256K1_CURVE_ORDER, sizeof(SECP256K1_CURVE_ORDER), &comparison);
+		if(comparison >= 0) {
+		
+			// Clear node
+			explicit_bzero(node, sizeof(node));
+			
+			// Return false
+			return false;
+		}
+		
+		// Check if adding the tweak to the private key failed
+		if(cx_math_addm_no_throw(privateKey, privateKey, node, SECP256K1_CURVE_ORDER, sizeof(SECP256K1_CURVE_ORDER)) != CX_OK) {
+		
+			// Clear node
+			explicit_bzero(node, sizeof(node));
+			
+			// Return false
+			return false;
+		}
+		
+		// Set chain code to the child node's
+		memcpy(chainCode, &node[sizeof(SECP256K1_CURVE_ORDER)], CHAIN_CODE_SIZE);
+	}
+	
+	// Clear node
+	explicit_bzero(node, sizeof(node));
+	
+	// Go through all bytes in the private key
+	for(size_t i = 0; i < sizeof(SECP256K1_CURVE_ORDER); ++i) {
+	
+		// Check if byte isn't zero
+		if(privateKey[i]) {
+		
+			// Return true
+			return true;
+		}
+	}
+	
+	// Return false
+	return false;
+}
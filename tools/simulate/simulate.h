@@ -0,0 +1,36 @@
+// Header guard
+#ifndef SIMULATE_H
+#define SIMULATE_H
+
+
+// Header files
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Definitions
+
+// Maximum seed size
+#define MAXIMUM_SEED_SIZE 64
+
+// Maximum random bytes size
+#define MAXIMUM_RANDOM_BYTES_SIZE 64
+
+
+// Function prototypes
+
+// Set seed (an empty seed restores the fixed node)
+bool setSeed(const uint8_t *newSeed, const size_t newSeedLength);
+
+// Set seed from string
+bool setSeedFromString(const char *string);
+
+// Set derivation memoisation
+void setDerivationMemoisation(const bool enable);
+
+// Set random bytes (empty random bytes restore the counting random bytes)
+bool setRandomBytes(const uint8_t *newRandomBytes, const size_t newRandomBytesLength);
+
+
+#endif
@@ -0,0 +1,875 @@
+// Header files
+#include <arpa/inet.h>
+#include <getopt.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include "common.h"
+#include "menus.h"
+#include "performance_counters.h"
+#include "process_requests.h"
+#include "root_public_key_cache.h"
+#include "simulate.h"
+#include "state.h"
+#include "storage.h"
+
+
+// Definitions
+
+// Default APDU port
+#define DEFAULT_APDU_PORT 9999
+
+// Default API port
+#define DEFAULT_API_PORT 5000
+
+// Default seed
+#define DEFAULT_SEED "abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon abandon about"
+
+// APDU length size
+#define APDU_LENGTH_SIZE sizeof(uint32_t)
+
+// Status size
+#define STATUS_SIZE sizeof(uint16_t)
+
+// Get application information class
+#define GET_APPLICATION_INFORMATION_CLASS 0xB0
+
+// Get application information instruction
+#define GET_APPLICATION_INFORMATION_INSTRUCTION 0x01
+
+// Application information format
+#define APPLICATION_INFORMATION_FORMAT 0x01
+
+// Application flags
+#define APPLICATION_FLAGS 0x00
+
+// HTTP request buffer size
+#define HTTP_REQUEST_BUFFER_SIZE 4096
+
+// HTTP headers end
+#define HTTP_HEADERS_END "\r\n\r\n"
+
+// HTTP content length header
+#define HTTP_CONTENT_LENGTH_HEADER "\r\nContent-Length:"
+
+// HTTP response
+#define HTTP_RESPONSE "HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nContent-Length: 2\r\nConnection: close\r\n\r\n{}"
+
+// No socket
+#define NO_SOCKET -1
+
+// Default number of sessions
+#define DEFAULT_NUMBER_OF_SESSIONS 1
+
+// Maximum number of sessions
+#define MAXIMUM_NUMBER_OF_SESSIONS 1024
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+	// Get performance counters class
+	#define GET_PERFORMANCE_COUNTERS_CLASS 0xE0
+
+	// Get performance counters instruction
+	#define GET_PERFORMANCE_COUNTERS_INSTRUCTION 0x01
+
+	// Read performance counters operation
+	#define READ_PERFORMANCE_COUNTERS_OPERATION 0x00
+
+	// Clear performance counters operation
+	#define CLEAR_PERFORMANCE_COUNTERS_OPERATION 0x01
+
+	// Performance counter entry size
+	#define PERFORMANCE_COUNTER_ENTRY_SIZE (sizeof(uint32_t) + sizeof(uint8_t) + sizeof(uint8_t) + sizeof(uint8_t))
+
+	// Maximum performance counters response data length
+	#define MAXIMUM_PERFORMANCE_COUNTERS_RESPONSE_DATA_LENGTH UINT8_MAX
+#endif
+
+
+// Structures
+
+// Session
+struct Session {
+
+	// APDU port
+	uint16_t apduPort;
+
+	// API port
+	uint16_t apiPort;
+
+	// Seed
+	const char *seed;
+};
+
+
+// Global variables
+
+// Sent response length
+static SESSION_LOCAL unsigned short sentResponseLength;
+
+
+// Function prototypes
+
+// Run session
+static bool runSession(const struct Session *session);
+
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Run session thread
+	static void *runSessionThread(void *session);
+#endif
+
+// Create listening socket
+static int createListeningSocket(const uint16_t port);
+
+// Receive all
+static bool receiveAll(const int socket, uint8_t *buffer, const size_t length);
+
+// Send all
+static bool sendAll(const int socket, const uint8_t *buffer, const size_t length);
+
+// Process APDU client
+static bool processApduClient(const int socket);
+
+// Process API client
+static void processApiClient(const int socket);
+
+// Exchange APDU
+static unsigned short exchangeApdu(const unsigned short requestLength);
+
+// Get application information
+static unsigned short getApplicationInformation(void);
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+	// Get performance counters
+	static unsigned short getPerformanceCounters(const unsigned short requestLength);
+#endif
+
+// Reset application
+static void resetApplication(void);
+
+
+// Main function
+int main(int argc, char *argv[]) {
+
+	// Initialize options
+	const struct option options[] = {
+		{"apdu-port", required_argument, NULL, 'a'},
+		{"api-port", required_argument, NULL, 'p'},
+		{"seed", required_argument, NULL, 's'},
+		{"sessions", required_argument, NULL, 'n'},
+		{"help", no_argument, NULL, 'h'},
+		{NULL, 0, NULL, 0}
+	};
+
+	// Initialize settings to their defaults
+	struct Session settings = {
+		.apduPort = DEFAULT_APDU_PORT,
+		.apiPort = DEFAULT_API_PORT,
+		.seed = DEFAULT_SEED
+	};
+	unsigned long numberOfSessions = DEFAULT_NUMBER_OF_SESSIONS;
+
+	// Go through all options
+	for(int option = getopt_long(argc, argv, "a:p:s:n:h", options, NULL); option != -1; option = getopt_long(argc, argv, "a:p:s:n:h", options, NULL)) {
+
+		// Check option
+		switch(option) {
+
+			// APDU port
+			case 'a':
+
+				// Set APDU port
+				settings.apduPort = strtoul(optarg, NULL, 10);
+
+				// Break
+				break;
+
+			// API port
+			case 'p':
+
+				// Set API port
+				settings.apiPort = strtoul(optarg, NULL, 10);
+
+				// Break
+				break;
+
+			// Seed
+			case 's':
+
+				// Set seed
+				settings.seed = optarg;
+
+				// Break
+				break;
+
+			// Number of sessions
+			case 'n':
+
+				// Set number of sessions
+				numberOfSessions = strtoul(optarg, NULL, 10);
+
+				// Break
+				break;
+
+			// Help or default
+			case 'h':
+			default:
+
+				// Display usage
+				fprintf(stderr, "Usage: %s [--apdu-port port] [--api-port port] [--seed \"mnemonic\" | --seed hex:seed] [--sessions number]\n", argv[0]);
+
+				// Return failure
+				return (option == 'h') ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+	}
+
+	// Check if number of sessions is invalid
+	if(!numberOfSessions || numberOfSessions > MAXIMUM_NUMBER_OF_SESSIONS || settings.apduPort + numberOfSessions - 1 > UINT16_MAX || settings.apiPort + numberOfSessions - 1 > UINT16_MAX) {
+
+		// Display message
+		fprintf(stderr, "Invalid number of sessions\n");
+
+		// Return failure
+		return EXIT_FAILURE;
+	}
+
+	// Check if only running one session
+	if(numberOfSessions == 1) {
+
+		// Return if running the session failed
+		return runSession(&settings) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Check if allocating memory for the sessions failed
+	struct Session *sessions = calloc(numberOfSessions, sizeof(struct Session));
+	pthread_t *threads = calloc(numberOfSessions, sizeof(pthread_t));
+	if(!sessions || !threads) {
+
+		// Free memory
+		free(sessions);
+		free(threads);
+
+		// Return failure
+		return EXIT_FAILURE;
+	}
+
+	// Go through all sessions
+	for(unsigned long i = 0; i < numberOfSessions; ++i) {
+
+		// Set session's ports to the next ports after the previous session's
+		sessions[i] = settings;
+		sessions[i].apduPort += i;
+		sessions[i].apiPort += i;
+
+		// Check if running session in a thread failed
+		if(pthread_create(&threads[i], NULL, runSessionThread, &sessions[i])) {
+
+			// Display message
+			fprintf(stderr, "Creating session %lu failed\n", i);
+
+			// Exit failure
+			exit(EXIT_FAILURE);
+		}
+	}
+
+	// Go through all sessions
+	for(unsigned long i = 0; i < numberOfSessions; ++i) {
+
+		// Wait for session's thread to finish
+		pthread_join(threads[i], NULL);
+	}
+
+	// Free memory
+	free(sessions);
+	free(threads);
+
+	// Return failure
+	return EXIT_FAILURE;
+
+// Otherwise
+#else
+
+	// Display message
+	fprintf(stderr, "Multiple sessions require building with MULTIPLE_SESSIONS\n");
+
+	// Return failure
+	return EXIT_FAILURE;
+#endif
+}
+
+
+// Supporting function implementation
+
+// IO exchange
+unsigned short io_exchange(unsigned char channelAndFlags, unsigned short length) {
+
+	// Check if sending a response
+	if(channelAndFlags & IO_RETURN_AFTER_TX) {
+
+		// Set sent response length
+		sentResponseLength = length;
+	}
+
+	// Return no request
+	return 0;
+}
+
+// Run session
+bool runSession(const struct Session *session) {
+
+	// Check if setting seed failed
+	if(!setSeedFromString(session->seed)) {
+
+		// Display message
+		fprintf(stderr, "Invalid seed\n");
+
+		// Return false
+		return false;
+	}
+
+	// Check if creating listening sockets failed
+	const int apduListeningSocket = createListeningSocket(session->apduPort);
+	const int apiListeningSocket = createListeningSocket(session->apiPort);
+	if(apduListeningSocket == NO_SOCKET || apiListeningSocket == NO_SOCKET) {
+
+		// Display message
+		fprintf(stderr, "Listening on ports %u and %u failed\n", session->apduPort, session->apiPort);
+
+		// Return false
+		return false;
+	}
+
+	// Reset application
+	resetApplication();
+
+	// Display message
+	printf("Listening for APDUs on port %u and API requests on port %u\n", session->apduPort, session->apiPort);
+	fflush(stdout);
+
+	// Loop forever
+	for(int apduClientSocket = NO_SOCKET;;) {
+
+		// Check if waiting for sockets failed
+		struct pollfd sockets[] = {
+			{.fd = apduListeningSocket, .events = POLLIN},
+			{.fd = apiListeningSocket, .events = POLLIN},
+			{.fd = apduClientSocket, .events = POLLIN}
+		};
+		if(poll(sockets, ARRAYLEN(sockets), -1) < 0) {
+
+			// Continue
+			continue;
+		}
+
+		// Check if an API client connected
+		if(sockets[1].revents & POLLIN) {
+
+			// Check if accepting API client was successful
+			const int apiClientSocket = accept(apiListeningSocket, NULL, NULL);
+			if(apiClientSocket != NO_SOCKET) {
+
+				// Process API client
+				processApiClient(apiClientSocket);
+
+				// Close API client socket
+				close(apiClientSocket);
+			}
+		}
+
+		// Check if an APDU client connected
+		if(sockets[0].revents & POLLIN) {
+
+			// Check if accepting APDU client was successful
+			const int newApduClientSocket = accept(apduListeningSocket, NULL, NULL);
+			if(newApduClientSocket != NO_SOCKET) {
+
+				// Check if an APDU client is already connected
+				if(apduClientSocket != NO_SOCKET) {
+
+					// Close APDU client socket
+					close(apduClientSocket);
+				}
+
+				// Set APDU client socket to the new APDU client socket
+				apduClientSocket = newApduClientSocket;
+			}
+		}
+
+		// Otherwise check if APDU client sent data or disconnected
+		else if(apduClientSocket != NO_SOCKET && sockets[2].revents) {
+
+			// Check if processing APDU client failed
+			if(!processApduClient(apduClientSocket)) {
+
+				// Close APDU client socket
+				close(apduClientSocket);
+				apduClientSocket = NO_SOCKET;
+			}
+		}
+	}
+}
+
+// Check if simulating multiple sessions
+#ifdef MULTIPLE_SESSIONS
+
+	// Run session thread
+	void *runSessionThread(void *session) {
+
+		// Run session
+		runSession(session);
+
+		// Return nothing
+		return NULL;
+	}
+#endif
+
+// Create listening socket
+int createListeningSocket(const uint16_t port) {
+
+	// Check if creating socket failed
+	const int listeningSocket = socket(AF_INET, SOCK_STREAM, 0);
+	if(listeningSocket == NO_SOCKET) {
+
+		// Return no socket
+		return NO_SOCKET;
+	}
+
+	// Allow reusing the address
+	const int reuseAddress = 1;
+	setsockopt(listeningSocket, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+
+	// Check if binding to the port or listening failed
+	const struct sockaddr_in address = {
+		.sin_family = AF_INET,
+		.sin_port = htons(port),
+		.sin_addr.s_addr = htonl(INADDR_ANY)
+	};
+	if(bind(listeningSocket, (const struct sockaddr *)&address, sizeof(address)) || listen(listeningSocket, SOMAXCONN)) {
+
+		// Close socket
+		close(listeningSocket);
+
+		// Return no socket
+		return NO_SOCKET;
+	}
+
+	// Return listening socket
+	return listeningSocket;
+}
+
+// Receive all
+bool receiveAll(const int socket, uint8_t *buffer, const size_t length) {
+
+	// Go through all bytes to receive
+	for(size_t received = 0; received < length;) {
+
+		// Check if receiving bytes failed
+		const ssize_t receivedBytes = recv(socket, &buffer[received], length - received, 0);
+		if(receivedBytes <= 0) {
+
+			// Return false
+			return false;
+		}
+
+		// Update received
+		received += receivedBytes;
+	}
+
+	// Return true
+	return true;
+}
+
+// Send all
+bool sendAll(const int socket, const uint8_t *buffer, const size_t length) {
+
+	// Go through all bytes to send
+	for(size_t sent = 0; sent < length;) {
+
+		// Check if sending bytes failed
+		const ssize_t sentBytes = send(socket, &buffer[sent], length - sent, MSG_NOSIGNAL);
+		if(sentBytes <= 0) {
+
+			// Return false
+			return false;
+		}
+
+		// Update sent
+		sent += sentBytes;
+	}
+
+	// Return true
+	return true;
+}
+
+// Process APDU client
+bool processApduClient(const int socket) {
+
+	// Check if receiving request's length failed
+	uint8_t requestLength[APDU_LENGTH_SIZE];
+	if(!receiveAll(socket, requestLength, sizeof(requestLength))) {
+
+		// Return false
+		return false;
+	}
+
+	// Check if request's length is invalid
+	const uint32_t length = U4BE(requestLength, 0);
+	if(!length || length >= sizeof(G_io_apdu_buffer)) {
+
+		// Return false
+		return false;
+	}
+
+	// Check if receiving request failed
+	if(!receiveAll(socket, G_io_apdu_buffer, length)) {
+
+		// Return false
+		return false;
+	}
+
+	// Exchange APDU
+	const unsigned short responseLength = exchangeApdu(length);
+
+	// Return if sending the response's data length, data, and status was successful
+	uint8_t responseDataLength[APDU_LENGTH_SIZE];
+	U4BE_ENCODE(responseDataLength, 0, responseLength - STATUS_SIZE);
+	return sendAll(socket, responseDataLength, sizeof(responseDataLength)) && sendAll(socket, G_io_apdu_buffer, responseLength);
+}
+
+// Process API client
+void processApiClient(const int socket) {
+
+	// Go through all of the request's headers
+	char request[HTTP_REQUEST_BUFFER_SIZE];
+	size_t requestLength = 0;
+	const char *headersEnd;
+	do {
+
+		// Check if request is too big or receiving part of it failed
+		const ssize_t receivedBytes = (requestLength < sizeof(request) - sizeof((char)'\0')) ? recv(socket, &request[requestLength], sizeof(request) - sizeof((char)'\0') - requestLength, 0) : 0;
+		if(receivedBytes <= 0) {
+
+			// Return
+			return;
+		}
+
+		// Update request length
+		requestLength += receivedBytes;
+		request[requestLength] = '\0';
+
+	} while(!(headersEnd = strstr(request, HTTP_HEADERS_END)));
+
+	// Get the request's body length
+	const char *contentLengthHeader = strstr(request, HTTP_CONTENT_LENGTH_HEADER);
+	size_t bodyLength = (contentLengthHeader && contentLengthHeader < headersEnd) ? strtoul(&contentLengthHeader[sizeof(HTTP_CONTENT_LENGTH_HEADER) - sizeof((char)'\0')], NULL, 10) : 0;
+
+	// Go through all of the body that wasn't received
+	for(size_t received = requestLength - (headersEnd + sizeof(HTTP_HEADERS_END) - sizeof((char)'\0') - request); received < bodyLength;) {
+
+		// Check if receiving part of the body failed
+		const ssize_t receivedBytes = recv(socket, request, MIN(sizeof(request), bodyLength - received), 0);
+		if(receivedBytes <= 0) {
+
+			// Return
+			return;
+		}
+
+		// Update received
+		received += receivedBytes;
+	}
+
+	// Send response
+	sendAll(socket, (const uint8_t *)HTTP_RESPONSE, sizeof(HTTP_RESPONSE) - sizeof((char)'\0'));
+}
+
+// Exchange APDU
+unsigned short exchangeApdu(const unsigned short requestLength) {
+
+	// Check if request is a get application information request
+	if(requestLength >= APDU_OFF_DATA && G_io_apdu_buffer[APDU_OFF_CLA] == GET_APPLICATION_INFORMATION_CLASS && G_io_apdu_buffer[APDU_OFF_INS] == GET_APPLICATION_INFORMATION_INSTRUCTION) {
+
+		// Return getting application information
+		return getApplicationInformation();
+	}
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+	// Check if request is a get performance counters request
+	if(requestLength >= APDU_OFF_DATA && G_io_apdu_buffer[APDU_OFF_CLA] == GET_PERFORMANCE_COUNTERS_CLASS && G_io_apdu_buffer[APDU_OFF_INS] == GET_PERFORMANCE_COUNTERS_INSTRUCTION) {
+
+		// Return getting performance counters
+		return getPerformanceCounters(requestLength);
+	}
+#endif
+
+	// Get request's instruction
+	const enum Instruction instruction = G_io_apdu_buffer[APDU_OFF_INS];
+
+	// Initialize response length
+	volatile unsigned short responseLength = 0;
+
+	// Initialize response flags
+	volatile unsigned char responseFlags = 0;
+
+	// Begin try
+	BEGIN_TRY {
+
+		// Try
+		TRY {
+
+			// Process request
+			processRequest(requestLength, &responseLength, &responseFlags);
+		}
+
+		// Catch other errors
+		CATCH_OTHER(error) {
+
+			// Check error type
+			switch(error & ERROR_TYPE_MASK) {
+
+				// Lower application errors
+				case ERR_APP_RANGE_01:
+				case ERR_APP_RANGE_02:
+
+					// Reset state
+					resetState();
+
+					// Break
+					break;
+
+				// Higher application errors or success
+				case ERR_APP_RANGE_03:
+				case ERR_APP_RANGE_04:
+				case SWO_SUCCESS:
+
+					// Break
+					break;
+
+				// Default
+				default:
+
+					// Reset state
+					resetState();
+
+					// Set error to internal error error
+					error = INTERNAL_ERROR_ERROR;
+
+					// Clear response
+					responseLength = 0;
+
+					// Break
+					break;
+			}
+
+			// Clear menu buffers
+			clearMenuBuffers();
+
+			// Check if response with the error will overflow
+			if(willResponseOverflow(responseLength, sizeof(uint16_t))) {
+
+				// Reset state
+				resetState();
+
+				// Set error to length error
+				error = ERR_APD_LEN;
+
+				// Clear response
+				responseLength = 0;
+			}
+
+			// Append error to response
+			U2BE_ENCODE(G_io_apdu_buffer, responseLength, error);
+
+			responseLength += sizeof(uint16_t);
+		}
+
+		// Finally
+		FINALLY {
+		}
+	}
+
+	// End try
+	END_TRY;
+
+	// Check if request is waiting for a user interaction
+	if(responseFlags & IO_ASYNCH_REPLY) {
+
+		// Reset sent response length
+		sentResponseLength = 0;
+
+		// Begin try
+		BEGIN_TRY {
+
+			// Try
+			TRY {
+
+				// Approve user interaction
+				processUserInteraction(instruction, true, false);
+			}
+
+			// Catch all errors
+			CATCH_ALL {
+
+				// Reset state
+				resetState();
+
+				// Set response to internal error error
+				U2BE_ENCODE(G_io_apdu_buffer, 0, INTERNAL_ERROR_ERROR);
+
+				sentResponseLength = sizeof(uint16_t);
+			}
+
+			// Finally
+			FINALLY {
+
+				// Clear menu buffers
+				clearMenuBuffers();
+			}
+		}
+
+		// End try
+		END_TRY;
+
+		// Set response length to the sent response length
+		responseLength = sentResponseLength;
+	}
+
+	// Return response length
+	return responseLength;
+}
+
+// Get application information
+unsigned short getApplicationInformation(void) {
+
+	// Set response's format
+	unsigned short responseLength = 0;
+	G_io_apdu_buffer[responseLength++] = APPLICATION_INFORMATION_FORMAT;
+
+	// Append application name to response
+	G_io_apdu_buffer[responseLength++] = sizeof(APPNAME) - sizeof((char)'\0');
+	memcpy(&G_io_apdu_buffer[responseLength], APPNAME, sizeof(APPNAME) - sizeof((char)'\0'));
+	responseLength += sizeof(APPNAME) - sizeof((char)'\0');
+
+	// Append application version to response
+	G_io_apdu_buffer[responseLength++] = sizeof(APPVERSION) - sizeof((char)'\0');
+	memcpy(&G_io_apdu_buffer[responseLength], APPVERSION, sizeof(APPVERSION) - sizeof((char)'\0'));
+	responseLength += sizeof(APPVERSION) - sizeof((char)'\0');
+
+	// Append application flags to response
+	G_io_apdu_buffer[responseLength++] = sizeof((uint8_t)APPLICATION_FLAGS);
+	G_io_apdu_buffer[responseLength++] = APPLICATION_FLAGS;
+
+	// Append success to response
+	U2BE_ENCODE(G_io_apdu_buffer, responseLength, SWO_SUCCESS);
+
+	// Return response length
+	return responseLength + sizeof(uint16_t);
+}
+
+// Check if debugging performance
+#ifdef DEBUG_PERF
+
+// Get performance counters
+unsigned short getPerformanceCounters(const unsigned short requestLength) {
+
+	// Get request's operation
+	const uint8_t operation = G_io_apdu_buffer[APDU_OFF_P1];
+
+	// Get request's data length
+	const size_t dataLength = requestLength - APDU_OFF_DATA;
+
+	// Get first entry index from the request's data if reading the performance counters
+	uint16_t firstEntryIndex = 0;
+	if(operation == READ_PERFORMANCE_COUNTERS_OPERATION && dataLength == sizeof(firstEntryIndex)) {
+
+		memcpy(&firstEntryIndex, &G_io_apdu_buffer[APDU_OFF_DATA], sizeof(firstEntryIndex));
+	}
+
+	// Get number of stored entries
+	const uint16_t numberOfStoredEntries = getNumberOfStoredPerformanceCounterEntries();
+
+	// Check if request is malformed or its parameters or data are invalid
+	if(dataLength != G_io_apdu_buffer[APDU_OFF_LC] || G_io_apdu_buffer[APDU_OFF_P2] || (operation == READ_PERFORMANCE_COUNTERS_OPERATION && (dataLength != sizeof(firstEntryIndex) || firstEntryIndex > numberOfStoredEntries)) || (operation == CLEAR_PERFORMANCE_COUNTERS_OPERATION && dataLength) || (operation != READ_PERFORMANCE_COUNTERS_OPERATION && operation != CLEAR_PERFORMANCE_COUNTERS_OPERATION)) {
+
+		// Set response to invalid parameters error
+		U2BE_ENCODE(G_io_apdu_buffer, 0, INVALID_PARAMETERS_ERROR);
+
+		// Return response length
+		return sizeof(uint16_t);
+	}
+
+	// Check if clearing the performance counters
+	if(operation == CLEAR_PERFORMANCE_COUNTERS_OPERATION) {
+
+		// Reset performance counters
+		resetPerformanceCounters();
+
+		// Set response to success
+		U2BE_ENCODE(G_io_apdu_buffer, 0, SWO_SUCCESS);
+
+		// Return response length
+		return sizeof(uint16_t);
+	}
+
+	// Set response's ticks per second
+	unsigned short responseLength = 0;
+	const uint32_t ticksPerSecond = PERFORMANCE_COUNTER_TICKS_PER_SECOND;
+	memcpy(&G_io_apdu_buffer[responseLength], &ticksPerSecond, sizeof(ticksPerSecond));
+	responseLength += sizeof(ticksPerSecond);
+
+	// Append number of recorded entries to response
+	memcpy(&G_io_apdu_buffer[responseLength], &performanceCounters.numberOfRecordedEntries, sizeof(performanceCounters.numberOfRecordedEntries));
+	responseLength += sizeof(performanceCounters.numberOfRecordedEntries);
+
+	// Append number of stored entries to response
+	memcpy(&G_io_apdu_buffer[responseLength], &numberOfStoredEntries, sizeof(numberOfStoredEntries));
+	responseLength += sizeof(numberOfStoredEntries);
+
+	// Go through all stored entries starting at the first entry index while the response has room for the entry
+	for(uint16_t i = firstEntryIndex; i < numberOfStoredEntries && responseLength + PERFORMANCE_COUNTER_ENTRY_SIZE <= MAXIMUM_PERFORMANCE_COUNTERS_RESPONSE_DATA_LENGTH; ++i) {
+
+		// Get entry
+		const struct PerformanceCounterEntry *entry = getStoredPerformanceCounterEntry(i);
+
+		// Append entry's ticks, stage, argument, and depth to response
+		memcpy(&G_io_apdu_buffer[responseLength], &entry->ticks, sizeof(entry->ticks));
+		responseLength += sizeof(entry->ticks);
+		G_io_apdu_buffer[responseLength++] = entry->stage;
+		G_io_apdu_buffer[responseLength++] = entry->argument;
+		G_io_apdu_buffer[responseLength++] = entry->depth;
+	}
+
+	// Append success to response
+	U2BE_ENCODE(G_io_apdu_buffer, responseLength, SWO_SUCCESS);
+
+	// Return response length
+	return responseLength + sizeof(uint16_t);
+}
+
+#endif
+
+// Reset application
+void resetApplication(void) {
+
+	// Reset state
+	resetState();
+	resetChainedApdu();
+	resetRootPublicKeyCache();
+	os_boot();
+	initializeStorage();
+	clearMenuBuffers();
+}